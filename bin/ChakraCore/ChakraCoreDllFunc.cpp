@@ -77,6 +77,9 @@ static BOOL AttachProcess(HANDLE hmod)
 #endif
     ValueType::Initialize();
     ThreadContext::GlobalInitialize();
+#if ENABLE_NATIVE_CODEGEN
+    PageAllocatorPool::Initialize();
+#endif
 
     // Needed to make sure that only ChakraCore is loaded into the process
     // This is unnecessary on Linux since there aren't other flavors of
@@ -113,6 +116,12 @@ static void DetachProcess()
     // shutdown is bad because we shouldn't free objects built into
     // other dlls.
     JsrtRuntime::Uninitialize();
+#if ENABLE_NATIVE_CODEGEN
+    PageAllocatorPool::Shutdown();
+#endif
+#if ENABLE_JIT_WARMUP_CACHE
+    Js::JitWarmupCache::Shutdown();
+#endif
 
     // thread-bound entrypoint should be able to get cleanup correctly, however tlsentry
     // for current thread might be left behind if this thread was initialized.
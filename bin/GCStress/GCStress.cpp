@@ -68,6 +68,22 @@ WeightedTable<Operation> operationTable;
 // Not used currently, but keep for now
 bool verbose = false;
 
+// Measure parallel mark scaling instead of running the stress loop
+bool parallelMarkScalingMode = false;
+static const unsigned int parallelMarkCollectCount = 10;
+
+// Measure allocation and full collection throughput instead of running the stress loop
+// (compare runs with and without -js -RecyclerHugePageSegments)
+bool throughputMode = false;
+static const unsigned int throughputAllocCount = 1000000;
+static const unsigned int throughputCollectCount = 10;
+
+// Churn a heap of stable size and report the page usage after each round instead of running the stress loop
+// (compare runs with and without -js -RecyclerSparseBlockThreshold:<percent>)
+bool fragmentationMode = false;
+static const unsigned int fragmentationRoundCount = 20;
+static const unsigned int fragmentationOperationsPerRound = 200000;
+
 
 RecyclerTestObject * CreateNewObject()
 {
@@ -206,6 +222,104 @@ void WalkHeap()
     RecyclerTestObject::EndWalk();
 }
 
+void ParallelMarkScalingTest()
+{
+#if ENABLE_CONCURRENT_GC
+    // Collect the same heap with an increasing number of mark threads.
+    // The heap walk after each round checks that every reachable object survived.
+    unsigned int maxParallelism = recyclerInstance->GetMaxParallelism();
+    if (maxParallelism < 2)
+    {
+        wprintf(_u("Parallel mark is disabled, nothing to measure\n"));
+        return;
+    }
+
+    Js::Tick::InitType();
+
+    wprintf(_u("Parallel mark scaling, up to %u threads (speedup is relative to 2 threads)\n"), maxParallelism);
+
+    int64 baselineTime = 0;
+    for (unsigned int parallelism = 2; parallelism <= maxParallelism; parallelism++)
+    {
+        recyclerInstance->SetMaxParallelism(parallelism);
+
+        Js::Tick start = Js::Tick::Now();
+        for (unsigned int i = 0; i < parallelMarkCollectCount; i++)
+        {
+            recyclerInstance->CollectNow<CollectNowForceInThread>();
+        }
+        int64 averageTime = (Js::Tick::Now() - start).ToMicroseconds() / parallelMarkCollectCount;
+
+        WalkHeap();
+
+        if (baselineTime == 0)
+        {
+            baselineTime = averageTime;
+        }
+
+        wprintf(_u("Threads: %2u   Collect time: %10lld us   Speedup: %5.2f\n"),
+            parallelism, (long long) averageTime, averageTime != 0 ? (double) baselineTime / averageTime : 0.0);
+    }
+
+    recyclerInstance->SetMaxParallelism(maxParallelism);
+#else
+    wprintf(_u("Parallel mark is not supported in this build\n"));
+#endif
+}
+
+void AllocMarkThroughputTest()
+{
+    Js::Tick::InitType();
+
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    wprintf(_u("Huge page segments: %s\n"), Js::Configuration::Global.flags.RecyclerHugePageSegments ? _u("on") : _u("off"));
+#endif
+
+    // Allocation: grow and churn the object graph, letting the recycler collect as it normally would
+    Js::Tick start = Js::Tick::Now();
+    for (unsigned int i = 0; i < throughputAllocCount; i++)
+    {
+        InsertObject();
+    }
+    int64 allocTime = (Js::Tick::Now() - start).ToMicroseconds();
+
+    // Mark: full in-thread collections of the resulting heap
+    start = Js::Tick::Now();
+    for (unsigned int i = 0; i < throughputCollectCount; i++)
+    {
+        recyclerInstance->CollectNow<CollectNowForceInThread>();
+    }
+    int64 collectTime = (Js::Tick::Now() - start).ToMicroseconds() / throughputCollectCount;
+
+    WalkHeap();
+
+    wprintf(_u("Allocations: %u   Alloc time: %10lld us   Allocs/ms: %10.1f\n"),
+        throughputAllocCount, (long long) allocTime, allocTime != 0 ? (double) throughputAllocCount * 1000 / allocTime : 0.0);
+    wprintf(_u("Collections: %u   Collect time: %10lld us\n"), throughputCollectCount, (long long) collectTime);
+}
+
+void FragmentationTest()
+{
+    wprintf(_u("Sparse block threshold: %d%%\n"), (int)Js::Configuration::Global.flags.RecyclerSparseBlockThreshold);
+
+    for (unsigned int round = 0; round < fragmentationRoundCount; round++)
+    {
+        // Drop and create objects at the same rate so the live heap stays roughly flat
+        for (unsigned int i = 0; i < fragmentationOperationsPerRound; i++)
+        {
+            DeleteObject();
+            InsertObject();
+        }
+
+        recyclerInstance->CollectNow<CollectNowForceInThread>();
+
+        WalkHeap();
+
+        wprintf(_u("Round: %2u   Used pages: %10llu KB\n"),
+            round, (unsigned long long) PageAllocator::GetProcessUsedBytes() / 1024);
+    }
+}
+
 void BuildObjectCreationTable()
 {
     // Populate the object creation func table
@@ -315,18 +429,33 @@ void SimpleRecyclerTest()
         // Do an initial walk
         WalkHeap();
 
-        // Loop, continually doing heap operations, and periodically doing a full heap walk
-        while (true)
+        if (parallelMarkScalingMode)
         {
-            for (unsigned int i = 0; i < operationsPerHeapWalk; i++)
+            ParallelMarkScalingTest();
+        }
+        else if (throughputMode)
+        {
+            AllocMarkThroughputTest();
+        }
+        else if (fragmentationMode)
+        {
+            FragmentationTest();
+        }
+        else
+        {
+            // Loop, continually doing heap operations, and periodically doing a full heap walk
+            while (true)
             {
-                DoHeapOperation();
-            }
-            
-            WalkHeap();
+                for (unsigned int i = 0; i < operationsPerHeapWalk; i++)
+                {
+                    DoHeapOperation();
+                }
 
-            // Dispose now
-            recyclerInstance->FinishDisposeObjectsNow<FinishDispose>();
+                WalkHeap();
+
+                // Dispose now
+                recyclerInstance->FinishDisposeObjectsNow<FinishDispose>();
+            }
         }
     }
     catch (Js::OutOfMemoryException)
@@ -359,8 +488,11 @@ bool GetDeviceFamilyInfo(
 void usage(const WCHAR* self)
 {
     wprintf(
-        _u("usage: %s [-?|-v] [-js <jscript options from here on>]\n")
-        _u("  -v\n\tverbose logging\n"),
+        _u("usage: %s [-?|-v|-parallelmark|-throughput|-fragmentation] [-js <jscript options from here on>]\n")
+        _u("  -v\n\tverbose logging\n")
+        _u("  -parallelmark\n\tmeasure full collection time as parallel mark threads are added (see -js -RecyclerMaxParallelism)\n")
+        _u("  -throughput\n\tmeasure allocation throughput and full collection time (see -js -RecyclerHugePageSegments)\n")
+        _u("  -fragmentation\n\tchurn a stable size heap and report used pages after each round (see -js -RecyclerSparseBlockThreshold)\n"),
         self);
 }
 
@@ -381,6 +513,18 @@ int __cdecl wmain(int argc, __in_ecount(argc) WCHAR* argv[])
             {
                 verbose = true;
             }
+            else if (wcscmp(argv[i], _u("-parallelmark")) == 0)
+            {
+                parallelMarkScalingMode = true;
+            }
+            else if (wcscmp(argv[i], _u("-throughput")) == 0)
+            {
+                throughputMode = true;
+            }
+            else if (wcscmp(argv[i], _u("-fragmentation")) == 0)
+            {
+                fragmentationMode = true;
+            }
             else if (wcscmp(argv[i], _u("-js")) == 0 || wcscmp(argv[i], _u("-JS")) == 0)
             {
                 jscriptOptions = i;
@@ -67,6 +67,7 @@ namespace JsRTApiTest
         WithSetup(JsRuntimeAttributeEnableIdleProcessing, handler);
         WithSetup(JsRuntimeAttributeDisableNativeCodeGeneration, handler);
         WithSetup(JsRuntimeAttributeDisableEval, handler);
+        WithSetup(JsRuntimeAttributeEnableNumaAffinity, handler);
         WithSetup((JsRuntimeAttributes)(JsRuntimeAttributeDisableBackgroundWork | JsRuntimeAttributeAllowScriptInterrupt | JsRuntimeAttributeEnableIdleProcessing), handler);
     }
 
@@ -1148,6 +1149,318 @@ namespace JsRTApiTest
         JsRTApiTest::RunWithAttributes(JsRTApiTest::ContextCleanupTest);
     }
 
+    void GCPauseBudgetTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // With a 1 microsecond budget every slice stops at its first deadline check, so marking the graph below
+        // takes many slices
+        REQUIRE(JsSetRuntimeGCPauseBudget(runtime, 1) == JsNoError);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var round = -1, live = [], rounds = []; for (var i = 0; i < 20000; i++) { live.push({ index: i, next: null }); rounds.push(-1); }"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        // Slices only run from JsIdle with idle processing on, and only when the recycler marks concurrently
+        const bool idle = (attributes & JsRuntimeAttributeEnableIdleProcessing) != 0;
+        const bool expectSlices = idle && !(attributes & JsRuntimeAttributeDisableBackgroundWork);
+        int unfinishedSlices = 0;
+        unsigned int nextIdleTick = 0;
+
+        // Allocate enough to start collections, and link new objects into the graph between the slices. They are
+        // only found through the write watch rescan, so they check that the mutator's changes are not lost.
+        for (int round = 0; round < 200; round++)
+        {
+            REQUIRE(JsRunScript(_u("round++; for (var i = 0; i < 500; i++) { var k = (i * 7919 + round * 31) % live.length; live[k].next = { round: round, garbage: new Array(8) }; rounds[k] = round; }"),
+                JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+            if (idle)
+            {
+                REQUIRE(JsIdle(&nextIdleTick) == JsNoError);
+
+                // An idle tick that is already due means a slice ran and the marking is not done yet
+                if (nextIdleTick <= GetTickCount())
+                {
+                    unfinishedSlices++;
+                }
+            }
+        }
+
+        if (expectSlices)
+        {
+            CHECK(unfinishedSlices > 0);
+
+            // Let the remaining slices finish the collection
+            for (int i = 0; i < 1000000 && nextIdleTick <= GetTickCount(); i++)
+            {
+                REQUIRE(JsIdle(&nextIdleTick) == JsNoError);
+            }
+            CHECK(nextIdleTick > GetTickCount());
+        }
+
+        LPCWSTR check = _u("var failures = 0; for (var i = 0; i < live.length; i++) {")
+            _u("  var next = live[i].next;")
+            _u("  if (live[i].index !== i) { failures++; }")
+            _u("  if (rounds[i] === -1 ? next !== null : (next.round !== rounds[i] || next.garbage.length !== 8)) { failures++; }")
+            _u("} failures");
+
+        // Everything reachable from live has to have survived the sliced collections, and then a full one
+        for (int i = 0; i < 2; i++)
+        {
+            int failures = -1;
+            REQUIRE(JsRunScript(check, JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+            REQUIRE(JsNumberToInt(result, &failures) == JsNoError);
+            CHECK(failures == 0);
+
+            REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        }
+
+        CHECK(JsSetRuntimeGCPauseBudget(runtime, 0) == JsNoError);
+        CHECK(JsSetRuntimeGCPauseBudget(JS_INVALID_RUNTIME_HANDLE, 200) == JsErrorInvalidArgument);
+    }
+
+    TEST_CASE("ApiTest_GCPauseBudgetTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::GCPauseBudgetTest);
+    }
+
+    void ProfileSerializationTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        LPCWSTR script = _u("function add(a, b) { return a + b; } var sum = 0; for (var i = 0; i < 100; i++) { sum = add(sum, i); } sum");
+        const JsSourceContext sourceContext = 1;
+        JsValueRef result = JS_INVALID_REFERENCE;
+        int intValue;
+
+        REQUIRE(JsRunScript(script, sourceContext, _u("profile.js"), &result) == JsNoError);
+        REQUIRE(JsNumberToInt(result, &intValue) == JsNoError);
+        CHECK(intValue == 4950);
+
+        unsigned int profileSize = 0;
+        CHECK(JsSerializeProfile(sourceContext + 1, nullptr, &profileSize) == JsErrorInvalidArgument);
+        REQUIRE(JsSerializeProfile(sourceContext, nullptr, &profileSize) == JsNoError);
+        REQUIRE(profileSize > 0);
+
+        BYTE *profile = new BYTE[profileSize];
+        unsigned int smallSize = profileSize - 1;
+        CHECK(JsSerializeProfile(sourceContext, profile, &smallSize) == JsErrorInvalidArgument);
+        CHECK(smallSize == profileSize);
+        unsigned int newProfileSize = profileSize;
+        REQUIRE(JsSerializeProfile(sourceContext, profile, &newProfileSize) == JsNoError);
+        CHECK(newProfileSize == profileSize);
+
+        // Already ran with this source context, too late to load a profile for it
+        CHECK(JsLoadProfile(sourceContext, profile, profileSize) == JsErrorInvalidArgument);
+
+        JsRuntimeHandle second = JS_INVALID_RUNTIME_HANDLE;
+        JsContextRef secondContext = JS_INVALID_REFERENCE, current = JS_INVALID_REFERENCE;
+
+        REQUIRE(JsCreateRuntime(attributes, NULL, &second) == JsNoError);
+        REQUIRE(JsCreateContext(second, &secondContext) == JsNoError);
+        REQUIRE(JsGetCurrentContext(&current) == JsNoError);
+        REQUIRE(JsSetCurrentContext(secondContext) == JsNoError);
+
+        BYTE corrupt[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+        CHECK(JsLoadProfile(sourceContext, corrupt, sizeof(corrupt)) == JsErrorBadSerializedScript);
+        CHECK(JsLoadProfile(sourceContext, profile, profileSize - 1) == JsErrorBadSerializedScript);
+
+        REQUIRE(JsLoadProfile(sourceContext, profile, profileSize) == JsNoError);
+        delete[] profile;
+
+        REQUIRE(JsRunScript(script, sourceContext, _u("profile.js"), &result) == JsNoError);
+        REQUIRE(JsNumberToInt(result, &intValue) == JsNoError);
+        CHECK(intValue == 4950);
+
+        REQUIRE(JsSetCurrentContext(current) == JsNoError);
+        REQUIRE(JsDisposeRuntime(second) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_ProfileSerializationTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ProfileSerializationTest);
+    }
+
+    void PolymorphicProfileSerializationTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // o.f() is a polymorphic call site, its profile holds a pointer that must not be serialized
+        LPCWSTR script = _u("function A() {} A.prototype.f = function () { return 1; };")
+            _u("function B() {} B.prototype.f = function () { return 2; };")
+            _u("function callF(o) { return o.f(); }")
+            _u("var a = new A(), b = new B(), sum = 0;")
+            _u("for (var i = 0; i < 10000; i++) { sum += callF(i % 2 ? a : b); }")
+            _u("sum");
+        const JsSourceContext sourceContext = 2;
+        JsValueRef result = JS_INVALID_REFERENCE;
+        int intValue;
+
+        REQUIRE(JsRunScript(script, sourceContext, _u("polymorphic.js"), &result) == JsNoError);
+        REQUIRE(JsNumberToInt(result, &intValue) == JsNoError);
+        CHECK(intValue == 15000);
+
+        unsigned int profileSize = 0;
+        REQUIRE(JsSerializeProfile(sourceContext, nullptr, &profileSize) == JsNoError);
+        REQUIRE(profileSize > 0);
+        BYTE *profile = new BYTE[profileSize];
+        REQUIRE(JsSerializeProfile(sourceContext, profile, &profileSize) == JsNoError);
+
+        JsRuntimeHandle second = JS_INVALID_RUNTIME_HANDLE;
+        JsContextRef secondContext = JS_INVALID_REFERENCE, current = JS_INVALID_REFERENCE;
+
+        REQUIRE(JsCreateRuntime(attributes, NULL, &second) == JsNoError);
+        REQUIRE(JsCreateContext(second, &secondContext) == JsNoError);
+        REQUIRE(JsGetCurrentContext(&current) == JsNoError);
+        REQUIRE(JsSetCurrentContext(secondContext) == JsNoError);
+
+        REQUIRE(JsLoadProfile(sourceContext, profile, profileSize) == JsNoError);
+        delete[] profile;
+
+        // The loaded profile sends callF straight to the JIT, which inlines from the call site profile
+        REQUIRE(JsRunScript(script, sourceContext, _u("polymorphic.js"), &result) == JsNoError);
+        REQUIRE(JsNumberToInt(result, &intValue) == JsNoError);
+        CHECK(intValue == 15000);
+
+        REQUIRE(JsSetCurrentContext(current) == JsNoError);
+        REQUIRE(JsDisposeRuntime(second) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_PolymorphicProfileSerializationTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::PolymorphicProfileSerializationTest);
+    }
+
+    static bool CHAKRA_CALLBACK SerializedFileLoadSourceCallback(JsSourceContext sourceContext, JsValueRef *value, JsParseScriptAttributes *parseAttributes)
+    {
+        // Running the script and reading its string constants must not need the source
+        CHECK(false);
+        return false;
+    }
+
+    void SerializedFileTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        LPCWSTR script = _u("function unused() { return 'never deserialized'; } function greet(name) { return 'hello ' + name; } greet('mapped file')");
+        JsValueRef result = JS_INVALID_REFERENCE;
+        BYTE *compiledScript = nullptr;
+        unsigned int scriptSize = 0;
+
+        REQUIRE(JsSerializeScript(script, compiledScript, &scriptSize) == JsNoError);
+        compiledScript = new BYTE[scriptSize];
+        REQUIRE(JsSerializeScript(script, compiledScript, &scriptSize) == JsNoError);
+
+        wchar_t tempDirectory[MAX_PATH];
+        wchar_t fileName[MAX_PATH];
+        REQUIRE(GetTempPathW(MAX_PATH, tempDirectory) != 0);
+        REQUIRE(GetTempFileNameW(tempDirectory, _u("jsb"), 0, fileName) != 0);
+
+        FILE *file = nullptr;
+        REQUIRE(_wfopen_s(&file, fileName, _u("wb")) == 0);
+        REQUIRE(fwrite(compiledScript, 1, scriptSize, file) == scriptSize);
+        fclose(file);
+
+        // A file holding only part of the buffer
+        wchar_t shortFileName[MAX_PATH];
+        const size_t shortSize = scriptSize / 2;
+        REQUIRE(GetTempFileNameW(tempDirectory, _u("jsb"), 0, shortFileName) != 0);
+        REQUIRE(_wfopen_s(&file, shortFileName, _u("wb")) == 0);
+        REQUIRE(fwrite(compiledScript, 1, shortSize, file) == shortSize);
+        fclose(file);
+        delete[] compiledScript;
+
+        JsRuntimeHandle second = JS_INVALID_RUNTIME_HANDLE;
+        JsContextRef secondContext = JS_INVALID_REFERENCE, current = JS_INVALID_REFERENCE;
+
+        REQUIRE(JsCreateRuntime(attributes, NULL, &second) == JsNoError);
+        REQUIRE(JsCreateContext(second, &secondContext) == JsNoError);
+        REQUIRE(JsGetCurrentContext(&current) == JsNoError);
+        REQUIRE(JsSetCurrentContext(secondContext) == JsNoError);
+
+        JsValueRef path = JS_INVALID_REFERENCE, missingPath = JS_INVALID_REFERENCE, shortPath = JS_INVALID_REFERENCE, sourceUrl = JS_INVALID_REFERENCE;
+        REQUIRE(JsPointerToString(fileName, wcslen(fileName), &path) == JsNoError);
+        REQUIRE(JsPointerToString(shortFileName, wcslen(shortFileName), &shortPath) == JsNoError);
+        REQUIRE(JsPointerToString(_u("does-not-exist.jsb"), wcslen(_u("does-not-exist.jsb")), &missingPath) == JsNoError);
+        REQUIRE(JsPointerToString(_u("mapped.js"), wcslen(_u("mapped.js")), &sourceUrl) == JsNoError);
+
+        CHECK(JsRunSerializedFile(missingPath, SerializedFileLoadSourceCallback, 1, sourceUrl, &result) == JsErrorInvalidArgument);
+        CHECK(JsRunSerializedFile(shortPath, SerializedFileLoadSourceCallback, 1, sourceUrl, &result) == JsErrorInvalidArgument);
+
+        // Run twice to use the view already mapped for the path
+        for (int i = 0; i < 2; i++)
+        {
+            REQUIRE(JsRunSerializedFile(path, SerializedFileLoadSourceCallback, 1, sourceUrl, &result) == JsNoError);
+
+            const wchar_t *stringValue;
+            size_t length;
+            REQUIRE(JsStringToPointer(result, &stringValue, &length) == JsNoError);
+            CHECK(length == wcslen(_u("hello mapped file")));
+            CHECK(wcscmp(stringValue, _u("hello mapped file")) == 0);
+        }
+
+        JsValueRef function = JS_INVALID_REFERENCE;
+        REQUIRE(JsParseSerializedFile(path, SerializedFileLoadSourceCallback, 1, sourceUrl, &function) == JsNoError);
+        JsValueType type;
+        REQUIRE(JsGetValueType(function, &type) == JsNoError);
+        CHECK(type == JsFunction);
+
+        REQUIRE(JsSetCurrentContext(current) == JsNoError);
+        REQUIRE(JsDisposeRuntime(second) == JsNoError);
+
+        // Unmapped with the runtime
+        CHECK(DeleteFileW(fileName));
+        CHECK(DeleteFileW(shortFileName));
+    }
+
+    TEST_CASE("ApiTest_SerializedFileTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::SerializedFileTest);
+    }
+
+    void ContextSnapshotTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        LPCWSTR script = _u("var count = 0; function greet(name) { count++; return 'hello ' + name; } greet('snapshot')");
+        JsValueRef scriptSource = JS_INVALID_REFERENCE, sourceUrl = JS_INVALID_REFERENCE, otherUrl = JS_INVALID_REFERENCE;
+        REQUIRE(JsPointerToString(script, wcslen(script), &scriptSource) == JsNoError);
+        REQUIRE(JsPointerToString(_u("snapshot.js"), wcslen(_u("snapshot.js")), &sourceUrl) == JsNoError);
+        REQUIRE(JsPointerToString(_u("other.js"), wcslen(_u("other.js")), &otherUrl) == JsNoError);
+
+        REQUIRE(JsCreateContextSnapshot(scriptSource, sourceUrl, JsParseScriptAttributeNone) == JsNoError);
+        CHECK(JsCreateContextSnapshot(scriptSource, sourceUrl, JsParseScriptAttributeNone) == JsErrorInvalidArgument);
+        CHECK(JsRunContextSnapshot(otherUrl, nullptr) == JsErrorInvalidArgument);
+
+        JsContextRef current = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetCurrentContext(&current) == JsNoError);
+
+        // Each context gets its own globals from the same snapshot
+        for (int i = 0; i < 2; i++)
+        {
+            JsContextRef context = JS_INVALID_REFERENCE;
+            REQUIRE(JsCreateContext(runtime, &context) == JsNoError);
+            REQUIRE(JsSetCurrentContext(context) == JsNoError);
+
+            JsValueRef result = JS_INVALID_REFERENCE;
+            REQUIRE(JsRunContextSnapshot(sourceUrl, &result) == JsNoError);
+
+            const wchar_t *stringValue;
+            size_t length;
+            REQUIRE(JsStringToPointer(result, &stringValue, &length) == JsNoError);
+            CHECK(wcscmp(stringValue, _u("hello snapshot")) == 0);
+
+            JsValueRef count = JS_INVALID_REFERENCE;
+            int countValue = 0;
+            REQUIRE(JsRunScript(_u("count"), JS_SOURCE_CONTEXT_NONE, _u(""), &count) == JsNoError);
+            REQUIRE(JsNumberToInt(count, &countValue) == JsNoError);
+            CHECK(countValue == 1);
+
+            // Needs the source kept by the runtime
+            JsValueRef text = JS_INVALID_REFERENCE;
+            REQUIRE(JsRunScript(_u("greet.toString()"), JS_SOURCE_CONTEXT_NONE, _u(""), &text) == JsNoError);
+            REQUIRE(JsStringToPointer(text, &stringValue, &length) == JsNoError);
+            CHECK(wcscmp(stringValue, _u("function greet(name) { count++; return 'hello ' + name; }")) == 0);
+
+            REQUIRE(JsSetCurrentContext(current) == JsNoError);
+        }
+    }
+
+    TEST_CASE("ApiTest_ContextSnapshotTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ContextSnapshotTest);
+    }
+
     void ObjectMethodTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
     {
         JsValueRef proto = JS_INVALID_REFERENCE;
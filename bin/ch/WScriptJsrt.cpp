@@ -425,7 +425,7 @@ JsValueRef WScriptJsrt::LoadScript(JsValueRef callee, LPCSTR fileName,
 
         IfJsrtErrorSetGo(ChakraRTInterface::JsSetCurrentContext(currentContext));
     }
-    else if (strcmp(scriptInjectType, "samethread") == 0)
+    else if (strcmp(scriptInjectType, "samethread") == 0 || strcmp(scriptInjectType, "snapshot") == 0)
     {
         JsValueRef newContext = JS_INVALID_REFERENCE;
 
@@ -448,8 +448,24 @@ JsValueRef WScriptJsrt::LoadScript(JsValueRef callee, LPCSTR fileName,
         JsValueRef fname;
         IfJsrtErrorSetGo(ChakraRTInterface::JsCreateStringUtf8((const uint8_t*)fullPathNarrow,
             strlen(fullPathNarrow), &fname));
-        errorCode = ChakraRTInterface::JsRun(scriptSource, GetNextSourceContext(),
-            fname, JsParseScriptAttributeNone, &returnValue);
+        if (strcmp(scriptInjectType, "snapshot") == 0)
+        {
+            // The first load of a file name compiles the snapshot; later loads run it and ignore the source
+            errorCode = ChakraRTInterface::JsRunContextSnapshot(fname, &returnValue);
+            if (errorCode == JsErrorInvalidArgument)
+            {
+                errorCode = ChakraRTInterface::JsCreateContextSnapshot(scriptSource, fname, JsParseScriptAttributeNone);
+                if (errorCode == JsNoError)
+                {
+                    errorCode = ChakraRTInterface::JsRunContextSnapshot(fname, &returnValue);
+                }
+            }
+        }
+        else
+        {
+            errorCode = ChakraRTInterface::JsRun(scriptSource, GetNextSourceContext(),
+                fname, JsParseScriptAttributeNone, &returnValue);
+        }
 
         if (errorCode == JsNoError)
         {
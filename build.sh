@@ -35,6 +35,9 @@ PRINT_USAGE() {
     echo "  -d, --debug          Debug build (by default Release build)"
     echo "      --embed-icu      Download and embed ICU-57 statically"
     echo "  -h, --help           Show help"
+    echo "      --huge-page-segments"
+    echo "                       Build in -RecyclerHugePageSegments (2MB"
+    echo "                       recycler page segments, 64-bit only)"
     echo "      --icu=PATH       Path to ICU include folder (see example below)"
     echo "  -j [N], --jobs[=N]   Multicore build, allow N jobs at once"
     echo "  -n, --ninja          Build with ninja instead of make"
@@ -43,6 +46,9 @@ PRINT_USAGE() {
     echo "      --lto            Enables LLVM Full LTO"
     echo "      --lto-thin       Enables LLVM Thin LTO - xcode 8+ or clang 3.9+"
     echo "      --static         Build as static library (by default shared library)"
+    echo "      --threaded-interpreter"
+    echo "                       Dispatch the interpreter loop through a"
+    echo "                       table of label addresses (computed goto)"
     echo "      --sanitize=CHECKS Build with clang -fsanitize checks,"
     echo "                       e.g. undefined,signed-integer-overflow"
     echo "  -t, --test-build     Test build (by default Release build)"
@@ -68,6 +74,8 @@ CMAKE_GEN=
 MAKE=make
 MULTICORE_BUILD=""
 NO_JIT=
+THREADED_INTERPRETER=
+HUGE_PAGE_SEGMENTS=
 ICU_PATH="-DICU_SETTINGS_RESET=1"
 STATIC_LIBRARY="-DSHARED_LIBRARY_SH=1"
 SANITIZE=
@@ -225,6 +233,14 @@ while [[ $# -gt 0 ]]; do
         STATIC_LIBRARY="-DSTATIC_LIBRARY_SH=1"
         ;;
 
+    --huge-page-segments)
+        HUGE_PAGE_SEGMENTS="-DHUGE_PAGE_SEGMENTS_SH=1"
+        ;;
+
+    --threaded-interpreter)
+        THREADED_INTERPRETER="-DTHREADED_INTERPRETER_SH=1"
+        ;;
+
     --sanitize=*)
         SANITIZE=$1
         SANITIZE=${SANITIZE:11}    # value after --sanitize=
@@ -333,7 +349,7 @@ fi
 
 echo Generating $BUILD_TYPE makefiles
 cmake $CMAKE_GEN $CC_PREFIX $ICU_PATH $LTO $STATIC_LIBRARY $ARCH \
-    -DCMAKE_BUILD_TYPE=$BUILD_TYPE $SANITIZE $NO_JIT $WITHOUT_FEATURES ../..
+    -DCMAKE_BUILD_TYPE=$BUILD_TYPE $SANITIZE $NO_JIT $THREADED_INTERPRETER $HUGE_PAGE_SEGMENTS $WITHOUT_FEATURES ../..
 
 _RET=$?
 if [[ $? == 0 ]]; then
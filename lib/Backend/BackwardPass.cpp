@@ -420,6 +420,14 @@ BackwardPass::Optimize()
     {
         this->RemoveEmptyLoops();
     }
+
+    // With -testtrace, functions without temp objects are visited too, to report the object literals they keep
+    if (this->tag == Js::DeadStorePhase && !PHASE_OFF(Js::DeadTempObjectPhase, this->func) &&
+        (this->func->GetHasMarkTempObjects() || PHASE_TESTTRACE(Js::DeadTempObjectPhase, this->func)))
+    {
+        this->RemoveDeadTempObjects();
+    }
+
     this->func->m_fg->hasBackwardPassInfo = true;
 
     if(DoTrackCompoundedIntOverflow())
@@ -4051,7 +4059,8 @@ BackwardPass::UpdateArrayBailOutKind(IR::Instr *const instr)
     Assert(instr->HasBailOutInfo());
 
     if ((instr->m_opcode != Js::OpCode::StElemI_A && instr->m_opcode != Js::OpCode::StElemI_A_Strict &&
-        instr->m_opcode != Js::OpCode::Memcopy && instr->m_opcode != Js::OpCode::Memset) ||
+        instr->m_opcode != Js::OpCode::Memcopy && instr->m_opcode != Js::OpCode::Memset &&
+        instr->m_opcode != Js::OpCode::Memadd && instr->m_opcode != Js::OpCode::Memmul) ||
         !instr->GetDst()->IsIndirOpnd())
     {
         return;
@@ -7771,6 +7780,171 @@ BackwardPass::RemoveEmptyLoops()
 
 }
 
+void
+BackwardPass::RemoveDeadTempObjects()
+{
+    // After field copy prop has replaced the loads from a non-escaping object literal, the object is often only referenced
+    // by the InitFlds that populate it. If no bailout needs to restore it either, nothing can observe the object, so its
+    // allocation and initialization are removed.
+    Assert(this->tag == Js::DeadStorePhase);
+
+    if (this->func->HasTry() || this->func->IsJitInDebugMode())
+    {
+        return;
+    }
+
+    BVSparse<JitArenaAllocator> candidateSyms(this->tempAlloc);
+    BVSparse<JitArenaAllocator> referencedSyms(this->tempAlloc);
+
+    const auto MarkReferenced = [&](IR::Opnd *const opnd)
+    {
+        if (opnd == nullptr)
+        {
+            return;
+        }
+
+        switch (opnd->GetKind())
+        {
+        case IR::OpndKindReg:
+            referencedSyms.Set(opnd->AsRegOpnd()->m_sym->m_id);
+            break;
+
+        case IR::OpndKindSym:
+        {
+            Sym *const sym = opnd->AsSymOpnd()->m_sym;
+            referencedSyms.Set(sym->IsPropertySym() ? sym->AsPropertySym()->m_stackSym->m_id : sym->m_id);
+            break;
+        }
+
+        case IR::OpndKindIndir:
+        {
+            IR::IndirOpnd *const indirOpnd = opnd->AsIndirOpnd();
+            if (indirOpnd->GetBaseOpnd())
+            {
+                referencedSyms.Set(indirOpnd->GetBaseOpnd()->m_sym->m_id);
+            }
+            if (indirOpnd->GetIndexOpnd())
+            {
+                referencedSyms.Set(indirOpnd->GetIndexOpnd()->m_sym->m_id);
+            }
+            break;
+        }
+        }
+    };
+
+    const auto MarkBailOutReferenced = [&](BailOutInfo *const bailOutInfo)
+    {
+        if (bailOutInfo->byteCodeUpwardExposedUsed)
+        {
+            referencedSyms.Or(bailOutInfo->byteCodeUpwardExposedUsed);
+        }
+        if (bailOutInfo->usedCapturedValues.argObjSyms)
+        {
+            referencedSyms.Or(bailOutInfo->usedCapturedValues.argObjSyms);
+        }
+        FOREACH_SLISTBASE_ENTRY(CopyPropSyms, copyPropSyms, &bailOutInfo->usedCapturedValues.copyPropSyms)
+        {
+            referencedSyms.Set(copyPropSyms.Key()->m_id);
+            referencedSyms.Set(copyPropSyms.Value()->m_id);
+        }
+        NEXT_SLISTBASE_ENTRY;
+        bailOutInfo->IterateArgOutSyms([&](uint, uint, StackSym *const sym)
+        {
+            referencedSyms.Set(sym->m_id);
+        });
+    };
+
+    // Being the object of an InitFld is the only reference that does not make an object literal observable. Anything else,
+    // including a use by a bailout, keeps it.
+    FOREACH_INSTR_IN_FUNC(instr, this->func)
+    {
+        if (instr->HasBailOutInfo())
+        {
+            MarkBailOutReferenced(instr->GetBailOutInfo());
+        }
+
+        switch (instr->m_opcode)
+        {
+        case Js::OpCode::NewScObjectLiteral:
+            if (instr->dstIsTempObject && instr->GetDst()->IsRegOpnd() && instr->GetDst()->AsRegOpnd()->m_sym->IsSingleDef())
+            {
+                candidateSyms.Set(instr->GetDst()->AsRegOpnd()->m_sym->m_id);
+            }
+            else
+            {
+                MarkReferenced(instr->GetDst());
+            }
+            break;
+
+        case Js::OpCode::InitFld:
+            Assert(instr->GetDst()->IsSymOpnd() && instr->GetDst()->AsSymOpnd()->m_sym->IsPropertySym());
+            break;
+
+        default:
+            MarkReferenced(instr->GetDst());
+            break;
+        }
+
+        MarkReferenced(instr->GetSrc1());
+        MarkReferenced(instr->GetSrc2());
+    }
+    NEXT_INSTR_IN_FUNC;
+
+    candidateSyms.Minus(&referencedSyms);
+    const bool testTrace = PHASE_TESTTRACE(Js::DeadTempObjectPhase, this->func);
+    if (candidateSyms.IsEmpty() && !testTrace)
+    {
+        return;
+    }
+
+    FOREACH_BLOCK_IN_FUNC(block, this->func)
+    {
+        FOREACH_INSTR_IN_BLOCK_EDITING(instr, instrNext, block)
+        {
+            StackSym * objSym;
+            switch (instr->m_opcode)
+            {
+            case Js::OpCode::NewScObjectLiteral:
+                objSym = instr->GetDst()->GetStackSym();
+                break;
+
+            case Js::OpCode::InitFld:
+                objSym = instr->GetDst()->AsSymOpnd()->m_sym->AsPropertySym()->m_stackSym;
+                break;
+
+            default:
+                continue;
+            }
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+            if (testTrace && instr->m_opcode == Js::OpCode::NewScObjectLiteral)
+            {
+                Output::Print(_u("DeadTempObject: object literal in %s %s\n"),
+                    instr->m_func->GetJITFunctionBody()->GetDisplayName(),
+                    objSym != nullptr && candidateSyms.Test(objSym->m_id) ? _u("removed") : _u("kept"));
+                Output::Flush();
+            }
+#endif
+
+            if (objSym == nullptr || !candidateSyms.Test(objSym->m_id))
+            {
+                continue;
+            }
+
+#if DBG_DUMP
+            if (PHASE_TRACE(Js::DeadTempObjectPhase, this->func))
+            {
+                Output::Print(_u("DeadTempObject: s%d: "), objSym->m_id);
+                instr->Dump();
+            }
+#endif
+            block->RemoveInstr(instr);
+        }
+        NEXT_INSTR_IN_BLOCK_EDITING;
+    }
+    NEXT_BLOCK_IN_FUNC;
+}
+
 void
 BackwardPass::RemoveEmptyLoopAfterMemOp(Loop *loop)
 {
@@ -61,6 +61,7 @@ private:
     bool IsEmptyLoopAfterMemOp(Loop *loop);
     void RestoreInductionVariableValuesAfterMemOp(Loop *loop);
     bool DoDeadStoreLdStForMemop(IR::Instr *instr);
+    void RemoveDeadTempObjects();
     bool DeadStoreInstr(IR::Instr *instr);
 
     void CollectCloneStrCandidate(IR::Opnd *opnd);
@@ -5,10 +5,23 @@
 #include "Backend.h"
 
 #if !FLOATVAR
-CodeGenNumberThreadAllocator::CodeGenNumberThreadAllocator(Recycler * recycler)
-    : recycler(recycler), currentNumberSegment(nullptr), currentChunkSegment(nullptr),
+CodeGenNumberThreadAllocator::BlockCache::BlockCache()
+    : currentNumberSegment(nullptr), currentChunkSegment(nullptr),
     numberSegmentEnd(nullptr), currentNumberBlockEnd(nullptr), nextNumber(nullptr), chunkSegmentEnd(nullptr),
-    currentChunkBlockEnd(nullptr), nextChunk(nullptr), hasNewNumberBlock(nullptr), hasNewChunkBlock(nullptr),
+    currentChunkBlockEnd(nullptr), nextChunk(nullptr), hasNewNumberBlock(false), hasNewChunkBlock(false),
+    nextCache(nullptr), nextFreeCache(nullptr)
+{
+}
+
+CodeGenNumberThreadAllocator::BlockCache::~BlockCache()
+{
+    pendingFlushNumberBlock.Clear(&NoThrowHeapAllocator::Instance);
+    pendingFlushChunkBlock.Clear(&NoThrowHeapAllocator::Instance);
+    pendingReferenceNumberBlock.Clear(&NoThrowHeapAllocator::Instance);
+}
+
+CodeGenNumberThreadAllocator::CodeGenNumberThreadAllocator(Recycler * recycler)
+    : recycler(recycler), cacheList(nullptr), freeCacheList(nullptr),
     pendingIntegrationNumberSegmentCount(0), pendingIntegrationChunkSegmentCount(0),
     pendingIntegrationNumberSegmentPageCount(0), pendingIntegrationChunkSegmentPageCount(0)
 {
@@ -16,13 +29,18 @@ CodeGenNumberThreadAllocator::CodeGenNumberThreadAllocator(Recycler * recycler)
 
 CodeGenNumberThreadAllocator::~CodeGenNumberThreadAllocator()
 {
+    while (cacheList != nullptr)
+    {
+        BlockCache * cache = cacheList;
+        cacheList = cache->nextCache;
+        HeapDelete(cache);
+    }
+    freeCacheList = nullptr;
+
     pendingIntegrationNumberSegment.Clear(&NoThrowNoMemProtectHeapAllocator::Instance);
     pendingIntegrationChunkSegment.Clear(&NoThrowNoMemProtectHeapAllocator::Instance);
     pendingIntegrationNumberBlock.Clear(&NoThrowHeapAllocator::Instance);
     pendingIntegrationChunkBlock.Clear(&NoThrowHeapAllocator::Instance);
-    pendingFlushNumberBlock.Clear(&NoThrowHeapAllocator::Instance);
-    pendingFlushChunkBlock.Clear(&NoThrowHeapAllocator::Instance);
-    pendingReferenceNumberBlock.Clear(&NoThrowHeapAllocator::Instance);
 }
 
 size_t
@@ -50,133 +68,182 @@ CodeGenNumberThreadAllocator::GetChunkAllocSize()
     return HeapInfo::GetAlignedSizeNoCheck(sizeof(CodeGenNumberChunk));
 }
 
-Js::JavascriptNumber *
-CodeGenNumberThreadAllocator::AllocNumber()
+CodeGenNumberThreadAllocator::BlockCache *
+CodeGenNumberThreadAllocator::AcquireCache()
 {
     AutoCriticalSection autocs(&cs);
+    BlockCache * cache = freeCacheList;
+    if (cache != nullptr)
+    {
+        freeCacheList = cache->nextFreeCache;
+        cache->nextFreeCache = nullptr;
+        return cache;
+    }
+
+    cache = HeapNew(BlockCache);
+    cache->nextCache = cacheList;
+    cacheList = cache;
+    return cache;
+}
+
+void
+CodeGenNumberThreadAllocator::ReleaseCache(BlockCache * cache)
+{
+    Assert(cache != nullptr && cache->nextFreeCache == nullptr);
+
+    // The code gen using this cache is done and the number link list is set on the
+    // entry point, so the finished blocks can be handed over for integration.
+    // The current partially used blocks stay with the cache for the next code gen.
+    AutoCriticalSection autocs(&cs);
+    cache->pendingFlushNumberBlock.MoveTo(&pendingIntegrationNumberBlock);
+    cache->pendingFlushChunkBlock.MoveTo(&pendingIntegrationChunkBlock);
+    cache->nextFreeCache = freeCacheList;
+    freeCacheList = cache;
+}
+
+Js::JavascriptNumber *
+CodeGenNumberThreadAllocator::AllocNumber(BlockCache * cache)
+{
     size_t sizeCat = GetNumberAllocSize();
-    if (nextNumber + sizeCat > currentNumberBlockEnd)
+    if (cache->nextNumber + sizeCat > cache->currentNumberBlockEnd)
     {
-        AllocNewNumberBlock();
+        AllocNewNumberBlock(cache);
     }
-    Js::JavascriptNumber * newNumber = (Js::JavascriptNumber *)nextNumber;
+    Js::JavascriptNumber * newNumber = (Js::JavascriptNumber *)cache->nextNumber;
 #ifdef RECYCLER_MEMORY_VERIFY
     recycler->FillCheckPad(newNumber, sizeof(Js::JavascriptNumber), sizeCat);
 #endif
 
-    nextNumber += sizeCat;
+    cache->nextNumber += sizeCat;
     return newNumber;
 }
 
 CodeGenNumberChunk *
-CodeGenNumberThreadAllocator::AllocChunk()
+CodeGenNumberThreadAllocator::AllocChunk(BlockCache * cache)
 {
-    AutoCriticalSection autocs(&cs);
     size_t sizeCat = GetChunkAllocSize();
-    if (nextChunk + sizeCat > currentChunkBlockEnd)
+    if (cache->nextChunk + sizeCat > cache->currentChunkBlockEnd)
     {
-        AllocNewChunkBlock();
+        AllocNewChunkBlock(cache);
     }
-    CodeGenNumberChunk * newChunk = (CodeGenNumberChunk *)nextChunk;
+    CodeGenNumberChunk * newChunk = (CodeGenNumberChunk *)cache->nextChunk;
 #ifdef RECYCLER_MEMORY_VERIFY
-    recycler->FillCheckPad(nextChunk, sizeof(CodeGenNumberChunk), sizeCat);
+    recycler->FillCheckPad(cache->nextChunk, sizeof(CodeGenNumberChunk), sizeCat);
 #endif
 
     memset(newChunk, 0, sizeof(CodeGenNumberChunk));
-    nextChunk += sizeCat;
+    cache->nextChunk += sizeCat;
     return newChunk;
 }
 
+PageSegment *
+CodeGenNumberThreadAllocator::AllocNumberSegment()
+{
+    AutoCriticalSection autocs(&cs);
+    // Reserve the segment, but not committing it
+    PageSegment * segment = PageAllocator::AllocPageSegment(pendingIntegrationNumberSegment, this->recycler->GetRecyclerLeafPageAllocator(), false, true);
+    if (segment != nullptr)
+    {
+        pendingIntegrationNumberSegmentCount++;
+        pendingIntegrationNumberSegmentPageCount += segment->GetPageCount();
+    }
+    return segment;
+}
+
+PageSegment *
+CodeGenNumberThreadAllocator::AllocChunkSegment()
+{
+    AutoCriticalSection autocs(&cs);
+    // Reserve the segment, but not committing it
+    PageSegment * segment = PageAllocator::AllocPageSegment(pendingIntegrationChunkSegment, this->recycler->GetRecyclerPageAllocator(), false, true);
+    if (segment != nullptr)
+    {
+        pendingIntegrationChunkSegmentCount++;
+        pendingIntegrationChunkSegmentPageCount += segment->GetPageCount();
+    }
+    return segment;
+}
+
 void
-CodeGenNumberThreadAllocator::AllocNewNumberBlock()
+CodeGenNumberThreadAllocator::AllocNewNumberBlock(BlockCache * cache)
 {
-    Assert(cs.IsLocked());
-    Assert(nextNumber + GetNumberAllocSize() > currentNumberBlockEnd);
-    if (hasNewNumberBlock)
+    Assert(cache->nextNumber + GetNumberAllocSize() > cache->currentNumberBlockEnd);
+    if (cache->hasNewNumberBlock)
     {
-        if (!pendingReferenceNumberBlock.PrependNode(&NoThrowHeapAllocator::Instance,
-            currentNumberBlockEnd - BlockSize, currentNumberSegment))
+        if (!cache->pendingReferenceNumberBlock.PrependNode(&NoThrowHeapAllocator::Instance,
+            cache->currentNumberBlockEnd - BlockSize, cache->currentNumberSegment))
         {
             Js::Throw::OutOfMemory();
         }
-        hasNewNumberBlock = false;
+        cache->hasNewNumberBlock = false;
     }
 
-    if (currentNumberBlockEnd == numberSegmentEnd)
+    if (cache->currentNumberBlockEnd == cache->numberSegmentEnd)
     {
-        Assert(cs.IsLocked());
-        // Reserve the segment, but not committing it
-        currentNumberSegment = PageAllocator::AllocPageSegment(pendingIntegrationNumberSegment, this->recycler->GetRecyclerLeafPageAllocator(), false, true);
-        if (currentNumberSegment == nullptr)
+        cache->currentNumberSegment = AllocNumberSegment();
+        if (cache->currentNumberSegment == nullptr)
         {
-            currentNumberBlockEnd = nullptr;
-            numberSegmentEnd = nullptr;
-            nextNumber = nullptr;
+            cache->currentNumberBlockEnd = nullptr;
+            cache->numberSegmentEnd = nullptr;
+            cache->nextNumber = nullptr;
             Js::Throw::OutOfMemory();
         }
-        pendingIntegrationNumberSegmentCount++;
-        pendingIntegrationNumberSegmentPageCount += currentNumberSegment->GetPageCount();
-        currentNumberBlockEnd = currentNumberSegment->GetAddress();
-        numberSegmentEnd = currentNumberSegment->GetEndAddress();
+        cache->currentNumberBlockEnd = cache->currentNumberSegment->GetAddress();
+        cache->numberSegmentEnd = cache->currentNumberSegment->GetEndAddress();
     }
 
     // Commit the page.
-    if (!::VirtualAlloc(currentNumberBlockEnd, BlockSize, MEM_COMMIT, PAGE_READWRITE))
+    if (!::VirtualAlloc(cache->currentNumberBlockEnd, BlockSize, MEM_COMMIT, PAGE_READWRITE))
     {
         Js::Throw::OutOfMemory();
     }
-    nextNumber = currentNumberBlockEnd;
-    currentNumberBlockEnd += BlockSize;
-    hasNewNumberBlock = true;
-    this->recycler->GetRecyclerLeafPageAllocator()->FillAllocPages(nextNumber, 1);
+    cache->nextNumber = cache->currentNumberBlockEnd;
+    cache->currentNumberBlockEnd += BlockSize;
+    cache->hasNewNumberBlock = true;
+    this->recycler->GetRecyclerLeafPageAllocator()->FillAllocPages(cache->nextNumber, 1);
 }
 
 void
-CodeGenNumberThreadAllocator::AllocNewChunkBlock()
+CodeGenNumberThreadAllocator::AllocNewChunkBlock(BlockCache * cache)
 {
-    Assert(cs.IsLocked());
-    Assert(nextChunk + GetChunkAllocSize() > currentChunkBlockEnd);
-    if (hasNewChunkBlock)
+    Assert(cache->nextChunk + GetChunkAllocSize() > cache->currentChunkBlockEnd);
+    if (cache->hasNewChunkBlock)
     {
-        if (!pendingFlushChunkBlock.PrependNode(&NoThrowHeapAllocator::Instance,
-            currentChunkBlockEnd - BlockSize, currentChunkSegment))
+        if (!cache->pendingFlushChunkBlock.PrependNode(&NoThrowHeapAllocator::Instance,
+            cache->currentChunkBlockEnd - BlockSize, cache->currentChunkSegment))
         {
             Js::Throw::OutOfMemory();
         }
         // All integrated pages' object are all live initially, so don't need to rescan them
-        ::ResetWriteWatch(currentChunkBlockEnd - BlockSize, BlockSize);
-        pendingReferenceNumberBlock.MoveTo(&pendingFlushNumberBlock);
-        hasNewChunkBlock = false;
+        ::ResetWriteWatch(cache->currentChunkBlockEnd - BlockSize, BlockSize);
+        cache->pendingReferenceNumberBlock.MoveTo(&cache->pendingFlushNumberBlock);
+        cache->hasNewChunkBlock = false;
     }
 
-    if (currentChunkBlockEnd == chunkSegmentEnd)
+    if (cache->currentChunkBlockEnd == cache->chunkSegmentEnd)
     {
-        Assert(cs.IsLocked());
-        // Reserve the segment, but not committing it
-        currentChunkSegment = PageAllocator::AllocPageSegment(pendingIntegrationChunkSegment, this->recycler->GetRecyclerPageAllocator(), false, true);
-        if (currentChunkSegment == nullptr)
+        cache->currentChunkSegment = AllocChunkSegment();
+        if (cache->currentChunkSegment == nullptr)
         {
-            currentChunkBlockEnd = nullptr;
-            chunkSegmentEnd = nullptr;
-            nextChunk = nullptr;
+            cache->currentChunkBlockEnd = nullptr;
+            cache->chunkSegmentEnd = nullptr;
+            cache->nextChunk = nullptr;
             Js::Throw::OutOfMemory();
         }
-        pendingIntegrationChunkSegmentCount++;
-        pendingIntegrationChunkSegmentPageCount += currentChunkSegment->GetPageCount();
-        currentChunkBlockEnd = currentChunkSegment->GetAddress();
-        chunkSegmentEnd = currentChunkSegment->GetEndAddress();
+        cache->currentChunkBlockEnd = cache->currentChunkSegment->GetAddress();
+        cache->chunkSegmentEnd = cache->currentChunkSegment->GetEndAddress();
     }
 
     // Commit the page.
-    if (!::VirtualAlloc(currentChunkBlockEnd, BlockSize, MEM_COMMIT, PAGE_READWRITE))
+    if (!::VirtualAlloc(cache->currentChunkBlockEnd, BlockSize, MEM_COMMIT, PAGE_READWRITE))
     {
         Js::Throw::OutOfMemory();
     }
 
-    nextChunk = currentChunkBlockEnd;
-    currentChunkBlockEnd += BlockSize;
-    hasNewChunkBlock = true;
-    this->recycler->GetRecyclerLeafPageAllocator()->FillAllocPages(nextChunk, 1);
+    cache->nextChunk = cache->currentChunkBlockEnd;
+    cache->currentChunkBlockEnd += BlockSize;
+    cache->hasNewChunkBlock = true;
+    this->recycler->GetRecyclerLeafPageAllocator()->FillAllocPages(cache->nextChunk, 1);
 }
 
 void
@@ -228,30 +295,37 @@ CodeGenNumberThreadAllocator::Integrate()
 #endif
 }
 
-void
-CodeGenNumberThreadAllocator::FlushAllocations()
-{
-    AutoCriticalSection autocs(&cs);
-    pendingFlushNumberBlock.MoveTo(&pendingIntegrationNumberBlock);
-    pendingFlushChunkBlock.MoveTo(&pendingIntegrationChunkBlock);
-}
-
 CodeGenNumberAllocator::CodeGenNumberAllocator(CodeGenNumberThreadAllocator * threadAlloc, Recycler * recycler) :
-    threadAlloc(threadAlloc), recycler(recycler), chunk(nullptr), chunkTail(nullptr), currentChunkNumberCount(CodeGenNumberChunk::MaxNumberCount)
+    threadAlloc(threadAlloc), threadCache(nullptr), recycler(recycler), chunk(nullptr), chunkTail(nullptr), currentChunkNumberCount(CodeGenNumberChunk::MaxNumberCount)
 {
 #if DBG
     finalized = false;
 #endif
 }
 
+CodeGenNumberAllocator::~CodeGenNumberAllocator()
+{
+    // Hand the blocks back once the whole code gen is done, so the chunks are already
+    // referenced by the entry point by the time they can be integrated
+    if (this->threadCache != nullptr)
+    {
+        this->threadAlloc->ReleaseCache(this->threadCache);
+        this->threadCache = nullptr;
+    }
+}
+
 // We should never call this function if we are using tagged float
 Js::JavascriptNumber *
 CodeGenNumberAllocator::Alloc()
 {
     Assert(!finalized);
+    if (threadAlloc != nullptr && threadCache == nullptr)
+    {
+        threadCache = threadAlloc->AcquireCache();
+    }
     if (currentChunkNumberCount == CodeGenNumberChunk::MaxNumberCount)
     {
-        CodeGenNumberChunk * newChunk = threadAlloc? threadAlloc->AllocChunk()
+        CodeGenNumberChunk * newChunk = threadAlloc? threadAlloc->AllocChunk(threadCache)
             : RecyclerNewStructZ(recycler, CodeGenNumberChunk);
         // Need to always put the new chunk last, as when we flush
         // pages, new chunk's page might not be full yet, and won't
@@ -268,7 +342,7 @@ CodeGenNumberAllocator::Alloc()
         this->chunkTail = newChunk;
         this->currentChunkNumberCount = 0;
     }
-    Js::JavascriptNumber * newNumber = threadAlloc? threadAlloc->AllocNumber()
+    Js::JavascriptNumber * newNumber = threadAlloc? threadAlloc->AllocNumber(threadCache)
         : Js::JavascriptNumber::NewUninitialized(recycler);
     this->chunkTail->numbers[this->currentChunkNumberCount++] = newNumber;
     return newNumber;
@@ -51,6 +51,15 @@
  *   pendingIntegration*Pages are synchronized, therefore the main thread
  *   can do the integration before GC happens.
  *
+ *   All of the per block state above lives in a BlockCache. Each JIT thread
+ *   checks out a cache for the duration of a function's code gen, and
+ *   allocates from it without taking the critical section. The lock is only
+ *   taken to reserve a new segment, and when the cache is returned, at which
+ *   point the finished blocks are handed over for integration in one batch.
+ *   Since a cache is only used by one code gen at a time, the ordering
+ *   between number blocks and the chunk blocks referencing them still holds
+ *   within each cache.
+ *
  ****************************************************************************/
 struct CodeGenNumberChunk
 {
@@ -65,48 +74,82 @@ CompileAssert(
 class CodeGenNumberThreadAllocator
 {
     friend struct XProcNumberPageSegmentManager;
+private:
+    struct BlockRecord
+    {
+        BlockRecord(__in_ecount_pagesize char * blockAddress, PageSegment * segment) 
+            : blockAddress(blockAddress), segment(segment) 
+        {
+        }
+        char * blockAddress;
+        PageSegment * segment;
+    };
+
 public:
+    class BlockCache
+    {
+        friend class CodeGenNumberThreadAllocator;
+    public:
+        BlockCache();
+        ~BlockCache();
+
+    private:
+        PageSegment * currentNumberSegment;
+        PageSegment * currentChunkSegment;
+        char * numberSegmentEnd;
+        char * currentNumberBlockEnd;
+        char * nextNumber;
+        char * chunkSegmentEnd;
+        char * currentChunkBlockEnd;
+        char * nextChunk;
+        bool hasNewNumberBlock;
+        bool hasNewChunkBlock;
+
+        // These are finished pages during the code gen of the current function
+        // We can't integrate them until the code gen is done for the function,
+        // because the references for the number is not set on the entry point yet.
+        SListBase<BlockRecord> pendingFlushNumberBlock;
+        SListBase<BlockRecord> pendingFlushChunkBlock;
+
+        // Numbers are reference by the chunks, so we need to wait until that is ready
+        // to be flushed before the number page can be flushed. Otherwise, we might have number
+        // integrated back to the GC, but the chunk hasn't yet, thus GC won't see the reference.
+        SListBase<BlockRecord> pendingReferenceNumberBlock;
+
+        BlockCache * nextCache;
+        BlockCache * nextFreeCache;
+    };
+
     CodeGenNumberThreadAllocator(Recycler * recycler);
     ~CodeGenNumberThreadAllocator();
 
-    // All the public API's need to be guarded by critical sections.
-    // Multiple jit threads access this.
-    Js::JavascriptNumber * AllocNumber();
-    CodeGenNumberChunk * AllocChunk();
+    // Multiple jit threads access this. Acquiring and releasing a cache are guarded
+    // by the critical section; allocating from an acquired cache is not.
+    BlockCache * AcquireCache();
+    void ReleaseCache(BlockCache * cache);
+    Js::JavascriptNumber * AllocNumber(BlockCache * cache);
+    CodeGenNumberChunk * AllocChunk(BlockCache * cache);
     void Integrate();
-    void FlushAllocations();
 
 private:
     // All allocations are small allocations
     const size_t BlockSize = SmallAllocationBlockAttributes::PageCount * AutoSystemInfo::PageSize;
 
-    void AllocNewNumberBlock();
-    void AllocNewChunkBlock();
+    void AllocNewNumberBlock(BlockCache * cache);
+    void AllocNewChunkBlock(BlockCache * cache);
+    PageSegment * AllocNumberSegment();
+    PageSegment * AllocChunkSegment();
     size_t GetNumberAllocSize();
     size_t GetChunkAllocSize();
 
     CriticalSection cs;
 
     Recycler * recycler;
-    PageSegment * currentNumberSegment;
-    PageSegment * currentChunkSegment;
-    char * numberSegmentEnd;
-    char * currentNumberBlockEnd;
-    char * nextNumber;
-    char * chunkSegmentEnd;
-    char * currentChunkBlockEnd;
-    char * nextChunk;
-    bool hasNewNumberBlock;
-    bool hasNewChunkBlock;
-    struct BlockRecord
-    {
-        BlockRecord(__in_ecount_pagesize char * blockAddress, PageSegment * segment) 
-            : blockAddress(blockAddress), segment(segment) 
-        {
-        }
-        char * blockAddress;
-        PageSegment * segment;
-    };
+
+    // All caches ever created, and the ones not currently checked out by a jit thread
+    BlockCache * cacheList;
+    BlockCache * freeCacheList;
+
     // Keep track of segments and pages that needs to be integrated to the recycler.
     uint pendingIntegrationNumberSegmentCount;
     uint pendingIntegrationChunkSegmentCount;
@@ -116,23 +159,13 @@ private:
     DListBase<PageSegment> pendingIntegrationChunkSegment;
     SListBase<BlockRecord> pendingIntegrationNumberBlock;
     SListBase<BlockRecord> pendingIntegrationChunkBlock;
-
-    // These are finished pages during the code gen of the current function
-    // We can't integrate them until the code gen is done for the function,
-    // because the references for the number is not set on the entry point yet.
-    SListBase<BlockRecord> pendingFlushNumberBlock;
-    SListBase<BlockRecord> pendingFlushChunkBlock;
-
-    // Numbers are reference by the chunks, so we need to wait until that is ready
-    // to be flushed before the number page can be flushed. Otherwise, we might have number
-    // integrated back to the GC, but the chunk hasn't yet, thus GC won't see the reference.
-    SListBase<BlockRecord> pendingReferenceNumberBlock;
 };
 
 class CodeGenNumberAllocator
 {
 public:
     CodeGenNumberAllocator(CodeGenNumberThreadAllocator * threadAlloc, Recycler * recycler);
+    ~CodeGenNumberAllocator();
 // We should never call this function if we are using tagged float
 #if !FLOATVAR
     Js::JavascriptNumber * Alloc();
@@ -142,6 +175,7 @@ private:
 
     Recycler * recycler;
     CodeGenNumberThreadAllocator * threadAlloc;
+    CodeGenNumberThreadAllocator::BlockCache * threadCache;
     CodeGenNumberChunk * chunk;
     CodeGenNumberChunk * chunkTail;
     uint currentChunkNumberCount;
@@ -634,7 +634,15 @@ public:
         SymID ldBase;
         StackSym* transferSym;
         byte ldCount;
-        MemCopyCandidate() : MemOpCandidate(MemOpCandidate::MEMCOPY) {}
+
+        // Element-wise operation between the load and the store (dst[i] = src[i] op operand), Nop if none.
+        // Subtraction of a constant is recorded as an addition of the negated constant.
+        Js::OpCode mapOpcode;
+        BailoutConstantValue mapConstant;
+        StackSym* mapSrcSym;
+
+        MemCopyCandidate() : MemOpCandidate(MemOpCandidate::MEMCOPY), mapOpcode(Js::OpCode::Nop), mapSrcSym(nullptr) {}
+        bool HasMap() const { return mapOpcode != Js::OpCode::Nop; }
     };
 
 #define FOREACH_MEMOP_CANDIDATES_EDITING(data, loop, iterator) FOREACH_SLISTCOUNTED_ENTRY_EDITING(Loop::MemOpCandidate*, data, loop->memOpInfo->candidates, iterator)
@@ -770,6 +778,7 @@ struct MemSetEmitData : public MemOpEmitData
 struct MemCopyEmitData : public MemOpEmitData
 {
     IR::Instr* ldElemInstr;
+    IR::Instr* mapInstr;
 };
 
 #define FOREACH_BLOCK_IN_FUNC(block, func)\
@@ -33,6 +33,7 @@ FunctionJITTimeInfo::BuildJITTimeData(
     jitData->localFuncId = codeGenData->GetFunctionInfo()->GetLocalFunctionId();
     jitData->isAggressiveInliningEnabled = codeGenData->GetIsAggressiveInliningEnabled();
     jitData->isInlined = codeGenData->GetIsInlined();
+    jitData->hasPolymorphicTail = codeGenData->GetHasPolymorphicTail();
     jitData->weakFuncRef = (intptr_t)codeGenData->GetWeakFuncRef();
 
     jitData->inlineesBv = (BVFixedIDL*)codeGenData->inlineesBv;
@@ -208,6 +209,12 @@ FunctionJITTimeInfo::IsInlined() const
     return m_data.isInlined != FALSE;
 }
 
+bool
+FunctionJITTimeInfo::HasPolymorphicTail() const
+{
+    return m_data.hasPolymorphicTail != FALSE;
+}
+
 const BVFixed *
 FunctionJITTimeInfo::GetInlineesBV() const
 {
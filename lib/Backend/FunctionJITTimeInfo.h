@@ -32,6 +32,7 @@ public:
     bool HasBody() const;
     bool IsAggressiveInliningEnabled() const;
     bool IsInlined() const;
+    bool HasPolymorphicTail() const;
     const FunctionJITRuntimeInfo * GetRuntimeInfo() const;
     const BVFixed * GetInlineesBV() const;
     const FunctionJITTimeInfo * GetJitTimeDataFromFunctionInfoAddr(intptr_t polyFuncInfo) const;
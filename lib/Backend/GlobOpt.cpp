@@ -258,6 +258,10 @@ GlobOpt::GlobOpt(Func * func)
         (!func->HasProfileInfo() || !func->GetReadOnlyProfileInfo()->IsTagCheckDisabled())),
     isAsmJSFunc(func->GetJITFunctionBody()->IsAsmJsMode())
 {
+#if DBG_DUMP
+    memset(boundCheckCounts, 0, sizeof(boundCheckCounts));
+    memset(boundCheckInLoopCounts, 0, sizeof(boundCheckInLoopCounts));
+#endif
 }
 
 void
@@ -310,6 +314,9 @@ GlobOpt::Optimize()
         this->maxInitialSymID = this->func->m_symTable->GetMaxSymID();
         this->BackwardPass(Js::BackwardPhase);
         this->ForwardPass();
+#if DBG_DUMP
+        this->TraceBoundCheckStats();
+#endif
     }
     this->BackwardPass(Js::DeadStorePhase);
     this->TailDupPass();
@@ -4629,7 +4636,8 @@ bool GlobOpt::CollectMemcopyStElementI(IR::Instr *instr, Loop *loop)
     // The previous candidate has to have been created by the matching ldElem
     if (
         memcopyInfo->base != Js::Constants::InvalidSymID ||
-        GetVarSymID(memcopyInfo->transferSym) != srcSymID
+        GetVarSymID(memcopyInfo->transferSym) != srcSymID ||
+        (memcopyInfo->HasMap() && src1->m_sym != memcopyInfo->transferSym)
     )
     {
         TRACE_MEMOP_PHASE_VERBOSE(MemCopy, loop, instr, _u("No matching LdElem found (s%d)"), baseSymID);
@@ -4654,6 +4662,124 @@ bool GlobOpt::CollectMemcopyStElementI(IR::Instr *instr, Loop *loop)
     return true;
 }
 
+bool
+GlobOpt::CollectMemcopyMapInstr(IR::Instr *instr, Loop *loop, Value *src1Val, Value *src2Val)
+{
+    // Accept a single arithmetic instruction between a memcopy LdElemI and its StElemI: dst[i] = src[i] op operand.
+    // Float operations are only accepted when type specialized, so that they compute exactly what the
+    // element-wise helper does, and int32 ones only when they wrap like a store to an Int32Array.
+    if (PHASE_OFF(Js::MemCopyPhase, this->func) || !loop->memOpInfo || loop->memOpInfo->candidates->Empty())
+    {
+        return false;
+    }
+
+    Loop::MemOpCandidate* previousCandidate = loop->memOpInfo->candidates->Head();
+    if (!previousCandidate->IsMemCopy())
+    {
+        return false;
+    }
+    Loop::MemCopyCandidate* memcopyInfo = previousCandidate->AsMemCopy();
+    if (memcopyInfo->base != Js::Constants::InvalidSymID || memcopyInfo->HasMap())
+    {
+        return false;
+    }
+
+    IRType type;
+    bool isSub = false;
+    switch (instr->m_opcode)
+    {
+    case Js::OpCode::Sub_A:
+        isSub = true;
+    case Js::OpCode::Add_A:
+    case Js::OpCode::Mul_A:
+        type = TyFloat64;
+        break;
+    case Js::OpCode::Sub_I4:
+        isSub = true;
+    case Js::OpCode::Add_I4:
+        type = TyInt32;
+        break;
+    default:
+        return false;
+    }
+
+    IR::Opnd *dst = instr->GetDst();
+    IR::Opnd *src1 = instr->GetSrc1();
+    IR::Opnd *src2 = instr->GetSrc2();
+    if (!dst || !dst->IsRegOpnd() || dst->GetType() != type || !dst->AsRegOpnd()->GetStackSym()->IsSingleDef() ||
+        !src2 || src1->GetType() != type || src2->GetType() != type)
+    {
+        return false;
+    }
+
+    // The loaded value must be used as is, and only by this instruction
+    IR::RegOpnd *transferOpnd = nullptr;
+    IR::Opnd *operand = nullptr;
+    if (src1->IsRegOpnd() && src1->AsRegOpnd()->m_sym == memcopyInfo->transferSym)
+    {
+        transferOpnd = src1->AsRegOpnd();
+        operand = src2;
+    }
+    else if (!isSub && src2->IsRegOpnd() && src2->AsRegOpnd()->m_sym == memcopyInfo->transferSym)
+    {
+        transferOpnd = src2->AsRegOpnd();
+        operand = src1;
+    }
+    else
+    {
+        return false;
+    }
+
+    if (!transferOpnd->GetIsDead() || (operand->IsRegOpnd() && operand->AsRegOpnd()->m_sym == memcopyInfo->transferSym))
+    {
+        TRACE_MEMOP_PHASE_VERBOSE(MemCopy, loop, instr, _u("LdElemI value (s%d) is used after the map operation"), GetVarSymID(memcopyInfo->transferSym));
+        return false;
+    }
+
+    if (this->MayNeedBailOnImplicitCall(instr, src1Val, src2Val))
+    {
+        TRACE_MEMOP_PHASE_VERBOSE(MemCopy, loop, instr, _u("Implicit call bailout detected on map operation"));
+        return false;
+    }
+
+    BailoutConstantValue constant = {TyIllegal, 0};
+    StackSym *srcSym = nullptr;
+    Value *operandVal = operand->IsRegOpnd() ? this->FindValue(operand->AsRegOpnd()->m_sym) : nullptr;
+    int32 intConstantValue;
+    if (operand->IsFloatConstOpnd() || (type == TyFloat64 && operandVal && operandVal->GetValueInfo()->IsFloatConstant()))
+    {
+        FloatConstType value = operand->IsFloatConstOpnd() ?
+            operand->AsFloatConstOpnd()->m_value :
+            operandVal->GetValueInfo()->AsFloatConstant()->FloatValue();
+        constant.InitFloatConstValue(isSub ? -value : value);
+    }
+    else if (type == TyInt32 && operand->IsIntConstOpnd())
+    {
+        const int32 value = (int32)operand->AsIntConstOpnd()->GetValue();
+        constant.InitIntConstValue(isSub ? (int32)(0u - (uint32)value) : value);
+    }
+    else if (type == TyInt32 && operandVal && operandVal->GetValueInfo()->TryGetIntConstantValue(&intConstantValue))
+    {
+        constant.InitIntConstValue(isSub ? (int32)(0u - (uint32)intConstantValue) : intConstantValue);
+    }
+    else if (!isSub && operand->IsRegOpnd() &&
+        this->OptIsInvariant(operand->AsRegOpnd(), this->currentBlock, loop, operandVal, true, true))
+    {
+        srcSym = operand->AsRegOpnd()->GetStackSym();
+    }
+    else
+    {
+        TRACE_MEMOP_PHASE_VERBOSE(MemCopy, loop, instr, _u("Map operand is not a constant or an invariant"));
+        return false;
+    }
+
+    memcopyInfo->mapOpcode = isSub ? (type == TyInt32 ? Js::OpCode::Add_I4 : Js::OpCode::Add_A) : instr->m_opcode;
+    memcopyInfo->mapConstant = constant;
+    memcopyInfo->mapSrcSym = srcSym;
+    memcopyInfo->transferSym = dst->AsRegOpnd()->GetStackSym();
+    return true;
+}
+
 bool
 GlobOpt::CollectMemOpLdElementI(IR::Instr *instr, Loop *loop)
 {
@@ -4797,6 +4923,11 @@ MemOpCheckInductionVariable:
         // Fallthrough if not an induction variable
     }
     default:
+        if (CollectMemcopyMapInstr(instr, loop, src1Val, src2Val))
+        {
+            break;
+        }
+
         if (IsInstrInvalidForMemOp(instr, loop, src1Val, src2Val))
         {
             loop->doMemOp = false;
@@ -16398,6 +16529,29 @@ GlobOpt::OptArraySrc(IR::Instr * *const instrRef)
         } while(false);
     }
 
+#if DBG_DUMP
+    if(needsBoundChecks && !IsLoopPrePass())
+    {
+        // Checks that are to be extracted are recorded below, once it is known whether they can be hoisted
+        if(eliminatedLowerBoundCheck)
+        {
+            RecordBoundCheck(BoundCheckEliminated);
+        }
+        else if(!doExtractBoundChecks)
+        {
+            RecordBoundCheck(BoundCheckNotExtracted);
+        }
+        if(eliminatedUpperBoundCheck)
+        {
+            RecordBoundCheck(BoundCheckEliminated);
+        }
+        else if(!doExtractBoundChecks)
+        {
+            RecordBoundCheck(BoundCheckNotExtracted);
+        }
+    }
+#endif
+
     if(doArrayChecks || doHeadSegmentLoad || doHeadSegmentLengthLoad || doLengthLoad || doExtractBoundChecks)
     {
         // Find the loops out of which array checks and head segment loads need to be hoisted
@@ -16890,6 +17044,12 @@ GlobOpt::OptArraySrc(IR::Instr * *const instrRef)
                 Assert(indexValue);
 
                 ArrayLowerBoundCheckHoistInfo &hoistInfo = lowerBoundCheckHoistInfo;
+#if DBG_DUMP
+                if(!IsLoopPrePass())
+                {
+                    RecordBoundCheck(hoistInfo.HasAnyInfo() ? BoundCheckHoisted : BoundCheckSeparated);
+                }
+#endif
                 if(hoistInfo.HasAnyInfo())
                 {
                     BasicBlock *hoistBlock;
@@ -17142,6 +17302,12 @@ GlobOpt::OptArraySrc(IR::Instr * *const instrRef)
                 eliminatedUpperBoundCheck = true;
 
                 ArrayUpperBoundCheckHoistInfo &hoistInfo = upperBoundCheckHoistInfo;
+#if DBG_DUMP
+                if(!IsLoopPrePass())
+                {
+                    RecordBoundCheck(hoistInfo.HasAnyInfo() ? BoundCheckHoisted : BoundCheckSeparated);
+                }
+#endif
                 if(hoistInfo.HasAnyInfo())
                 {
                     BasicBlock *hoistBlock;
@@ -20879,6 +21045,72 @@ GlobOpt::TraceSettings()
 
     Output::Flush();
 }
+
+void
+GlobOpt::RecordBoundCheck(const BoundCheckDisposition disposition)
+{
+    Assert(disposition < BoundCheckDispositionCount);
+    Assert(!this->IsLoopPrePass());
+
+    ++this->boundCheckCounts[disposition];
+    if(this->currentBlock->loop)
+    {
+        ++this->boundCheckInLoopCounts[disposition];
+    }
+}
+
+void
+GlobOpt::TraceBoundCheckStats()
+{
+    if(!PHASE_TRACE(Js::BoundCheckEliminationPhase, this->func))
+    {
+        return;
+    }
+
+    uint total = 0, totalInLoops = 0;
+    for(uint i = 0; i < BoundCheckDispositionCount; ++i)
+    {
+        total += this->boundCheckCounts[i];
+        totalInLoops += this->boundCheckInLoopCounts[i];
+    }
+    if(total == 0)
+    {
+        return;
+    }
+
+    // Hoisted checks still execute, but once per loop entry instead of once per access
+    const uint remaining = this->boundCheckCounts[BoundCheckSeparated] + this->boundCheckCounts[BoundCheckNotExtracted];
+    const uint remainingInLoops =
+        this->boundCheckInLoopCounts[BoundCheckSeparated] + this->boundCheckInLoopCounts[BoundCheckNotExtracted];
+
+    char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
+    Output::Print(
+        _u("Function %s (%s)"),
+        this->func->GetJITFunctionBody()->GetDisplayName(),
+        this->func->GetDebugNumberSet(debugStringBuffer));
+    if(this->func->IsLoopBody())
+    {
+        Output::Print(_u(", loop %u"), this->func->GetWorkItem()->GetLoopNumber());
+    }
+    Output::Print(_u(" - %s\n"), Js::PhaseNames[Js::BoundCheckEliminationPhase]);
+    Output::Print(
+        _u("    Bound checks: %u total (%u in loops), %u eliminated (%u in loops), %u hoisted (%u in loops), %u remaining (%u in loops)\n"),
+        total,
+        totalInLoops,
+        this->boundCheckCounts[BoundCheckEliminated],
+        this->boundCheckInLoopCounts[BoundCheckEliminated],
+        this->boundCheckCounts[BoundCheckHoisted],
+        this->boundCheckInLoopCounts[BoundCheckHoisted],
+        remaining,
+        remainingInLoops);
+    Output::Print(
+        _u("    Remaining: %u separated (%u in loops), %u not extracted (%u in loops)\n"),
+        this->boundCheckCounts[BoundCheckSeparated],
+        this->boundCheckInLoopCounts[BoundCheckSeparated],
+        this->boundCheckCounts[BoundCheckNotExtracted],
+        this->boundCheckInLoopCounts[BoundCheckNotExtracted]);
+    Output::Flush();
+}
 #endif  // DBG_DUMP
 
 IR::Instr *
@@ -21392,10 +21624,13 @@ void
 GlobOpt::RemoveMemOpSrcInstr(IR::Instr* memopInstr, IR::Instr* srcInstr, BasicBlock* block)
 {
     Assert(srcInstr && (srcInstr->m_opcode == Js::OpCode::LdElemI_A || srcInstr->m_opcode == Js::OpCode::StElemI_A || srcInstr->m_opcode == Js::OpCode::StElemI_A_Strict));
-    Assert(memopInstr && (memopInstr->m_opcode == Js::OpCode::Memcopy || memopInstr->m_opcode == Js::OpCode::Memset));
+    Assert(memopInstr && (memopInstr->m_opcode == Js::OpCode::Memcopy || memopInstr->m_opcode == Js::OpCode::Memset ||
+        memopInstr->m_opcode == Js::OpCode::Memadd || memopInstr->m_opcode == Js::OpCode::Memmul));
     Assert(block);
     const bool isDst = srcInstr->m_opcode == Js::OpCode::StElemI_A || srcInstr->m_opcode == Js::OpCode::StElemI_A_Strict;
-    IR::RegOpnd* opnd = (isDst ? memopInstr->GetDst() : memopInstr->GetSrc1())->AsIndirOpnd()->GetBaseOpnd();
+    // Memadd and Memmul update their destination in place, so it is also the array the LdElemI read from
+    IR::Opnd* memopArrayOpnd = isDst || !memopInstr->GetSrc1()->IsIndirOpnd() ? memopInstr->GetDst() : memopInstr->GetSrc1();
+    IR::RegOpnd* opnd = memopArrayOpnd->AsIndirOpnd()->GetBaseOpnd();
     IR::ArrayRegOpnd* arrayOpnd = opnd->IsArrayRegOpnd() ? opnd->AsArrayRegOpnd() : nullptr;
 
     IR::Instr* topInstr = srcInstr;
@@ -21554,12 +21789,52 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
         src1 = IR::IndirOpnd::New(srcBaseOpnd, startIndexOpnd, srcType, localFunc);
     }
 
-    // Generate memcopy
-    IR::Instr* memopInstr = IR::BailOutInstr::New(isMemset ? Js::OpCode::Memset : Js::OpCode::Memcopy, bailOutKind, bailOutInfo, localFunc);
-    memopInstr->SetDst(dstOpnd);
-    memopInstr->SetSrc1(src1);
-    memopInstr->SetSrc2(sizeOpnd);
-    insertBeforeInstr->InsertBefore(memopInstr);
+    const Loop::MemCopyCandidate* mapCandidate = !isMemset && emitData->candidate->AsMemCopy()->HasMap() ? emitData->candidate->AsMemCopy() : nullptr;
+
+    // Generate memcopy. A map of an array onto itself has nothing to copy.
+    IR::Instr* memopInstr = nullptr;
+    if (!mapCandidate || mapCandidate->ldBase != mapCandidate->base)
+    {
+        memopInstr = IR::BailOutInstr::New(isMemset ? Js::OpCode::Memset : Js::OpCode::Memcopy, bailOutKind, bailOutInfo, localFunc);
+        memopInstr->SetDst(dstOpnd);
+        memopInstr->SetSrc1(src1);
+        memopInstr->SetSrc2(sizeOpnd);
+        insertBeforeInstr->InsertBefore(memopInstr);
+    }
+    else
+    {
+        dstOpnd->Free(localFunc);
+        src1->Free(localFunc);
+    }
+
+    // Then apply the element-wise operation in place on the destination. The helper only writes when it can
+    // process the whole range, so a bailout from either memop still leaves the loop safe to re-execute.
+    IR::Instr* mapInstr = nullptr;
+    if (mapCandidate)
+    {
+        IR::Opnd *mapSrc;
+        if (mapCandidate->mapSrcSym)
+        {
+            IR::RegOpnd* regSrc = IR::RegOpnd::New(mapCandidate->mapSrcSym, mapCandidate->mapSrcSym->GetType(), func);
+            regSrc->SetIsJITOptimizedReg(true);
+            mapSrc = regSrc;
+        }
+        else
+        {
+            mapSrc = IR::AddrOpnd::New(mapCandidate->mapConstant.ToVar(localFunc), IR::AddrOpndKindConstantAddress, localFunc);
+        }
+
+        mapInstr = IR::BailOutInstr::New(mapCandidate->mapOpcode == Js::OpCode::Mul_A ? Js::OpCode::Memmul : Js::OpCode::Memadd, bailOutKind, bailOutInfo, localFunc);
+        mapInstr->SetDst(IR::IndirOpnd::New(baseOpnd, startIndexOpnd, dstType, localFunc));
+        mapInstr->SetSrc1(mapSrc);
+        mapInstr->SetSrc2(sizeOpnd);
+        insertBeforeInstr->InsertBefore(mapInstr);
+
+        if (!memopInstr)
+        {
+            memopInstr = mapInstr;
+        }
+    }
 
 #if DBG_DUMP
     if (DO_MEMOP_TRACE())
@@ -21621,13 +21896,14 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
         {
             const Loop::MemCopyCandidate* candidate = emitData->candidate->AsMemCopy();
             TRACE_MEMOP_PHASE(MemCopy, loop, emitData->stElemInstr,
-                              _u("ValueType: %S, StBase: s%u, Index: s%u, LdBase: s%u, LoopCount: %s, IsIndexChangedBeforeUse: %d"),
+                              _u("ValueType: %S, StBase: s%u, Index: s%u, LdBase: s%u, LoopCount: %s, IsIndexChangedBeforeUse: %d, Map: %s"),
                               valueTypeStr,
                               candidate->base,
                               candidate->index,
                               candidate->ldBase,
                               loopCountBuf,
-                              bIndexAlreadyChanged);
+                              bIndexAlreadyChanged,
+                              candidate->HasMap() ? Js::OpCodeUtil::GetOpCodeName(mapInstr->m_opcode) : _u("none"));
         }
 
     }
@@ -21637,6 +21913,38 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
     if (!isMemset)
     {
         RemoveMemOpSrcInstr(memopInstr, ((MemCopyEmitData*)emitData)->ldElemInstr, emitData->block);
+        if (mapCandidate)
+        {
+            this->ConvertToByteCodeUses(((MemCopyEmitData*)emitData)->mapInstr);
+        }
+    }
+}
+
+static bool
+IsMemOpMapAllowedForArray(Js::OpCode mapOpcode, ValueType arrayValueType)
+{
+    // Only the arrays the Op_Memadd/Op_Memmul helpers handle
+    if (!arrayValueType.IsTypedArray())
+    {
+        return false;
+    }
+    switch (arrayValueType.GetObjectType())
+    {
+    case ObjectType::Int32Array:
+    case ObjectType::Int32VirtualArray:
+    case ObjectType::Int32MixedArray:
+        return mapOpcode == Js::OpCode::Add_I4;
+
+    case ObjectType::Float32Array:
+    case ObjectType::Float32VirtualArray:
+    case ObjectType::Float32MixedArray:
+    case ObjectType::Float64Array:
+    case ObjectType::Float64VirtualArray:
+    case ObjectType::Float64MixedArray:
+        return mapOpcode == Js::OpCode::Add_A || mapOpcode == Js::OpCode::Mul_A;
+
+    default:
+        return false;
     }
 }
 
@@ -21703,6 +22011,12 @@ GlobOpt::InspectInstrForMemCopyCandidate(Loop* loop, IR::Instr* instr, MemCopyEm
             emitData->ldElemInstr = instr;
             ValueType stValueType = emitData->stElemInstr->GetDst()->AsIndirOpnd()->GetBaseOpnd()->GetValueType();
             ValueType ldValueType = emitData->ldElemInstr->GetSrc1()->AsIndirOpnd()->GetBaseOpnd()->GetValueType();
+            if (candidate->HasMap() && (!emitData->mapInstr || !IsMemOpMapAllowedForArray(candidate->mapOpcode, stValueType)))
+            {
+                TRACE_MEMOP_PHASE_VERBOSE(MemCopy, loop, instr, _u("Map operation not found or not supported for this array"));
+                errorInInstr = true;
+                return false;
+            }
             if (stValueType != ldValueType)
             {
 #if DBG_DUMP
@@ -21721,6 +22035,17 @@ GlobOpt::InspectInstrForMemCopyCandidate(Loop* loop, IR::Instr* instr, MemCopyEm
         TRACE_MEMOP_PHASE_VERBOSE(MemCopy, loop, instr, _u("Orphan LdElemI_A detected"));
         errorInInstr = true;
     }
+    else if (
+        candidate->HasMap() &&
+        emitData->stElemInstr &&
+        !emitData->ldElemInstr &&
+        instr->GetDst() &&
+        instr->GetDst()->IsRegOpnd() &&
+        instr->GetDst()->AsRegOpnd()->m_sym == candidate->transferSym
+        )
+    {
+        emitData->mapInstr = instr;
+    }
     return false;
 }
 
@@ -1274,6 +1274,19 @@ private:
 #if DBG
     BVSparse<JitArenaAllocator> * byteCodeUsesBeforeOpt;
 #endif
+#if DBG_DUMP
+    // What the forward pass did with each array lower and upper bound check, reported with -trace:BoundCheckElimination
+    enum BoundCheckDisposition
+    {
+        BoundCheckEliminated,       // proven unnecessary at compile time
+        BoundCheckHoisted,          // hoisted out of a loop or merged into an earlier compatible bound check
+        BoundCheckSeparated,        // extracted into a BoundCheck instruction in front of the access
+        BoundCheckNotExtracted,     // left to the access itself
+        BoundCheckDispositionCount
+    };
+    uint                    boundCheckCounts[BoundCheckDispositionCount];
+    uint                    boundCheckInLoopCounts[BoundCheckDispositionCount];
+#endif
 public:
     GlobOpt(Func * func);
 
@@ -1460,6 +1473,7 @@ private:
     bool                    CollectMemcopyStElementI(IR::Instr *, Loop *);
     bool                    CollectMemOpLdElementI(IR::Instr *, Loop *);
     bool                    CollectMemcopyLdElementI(IR::Instr *, Loop *);
+    bool                    CollectMemcopyMapInstr(IR::Instr *, Loop *, Value *, Value *);
     SymID                   GetVarSymID(StackSym *);
     const InductionVariable* GetInductionVariable(SymID, Loop *);
     bool                    IsSymIDInductionVariable(SymID, Loop *);
@@ -1801,6 +1815,8 @@ private:
 
     void                    Trace(BasicBlock * basicBlock, bool before);
     void                    TraceSettings();
+    void                    RecordBoundCheck(const BoundCheckDisposition disposition);
+    void                    TraceBoundCheckStats();
 #endif
 
     bool                    IsWorthSpecializingToInt32Branch(IR::Instr * instr, Value * src1Val, Value * src2Val);
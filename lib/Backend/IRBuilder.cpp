@@ -4381,6 +4381,13 @@ IRBuilder::BuildElementCP(Js::OpCode newOpcode, uint32 offset, Js::RegSlot insta
         Js::OpCodeUtil::ConvertNonCallOpToNonProfiled(newOpcode);
     }
 
+    if (newOpcode == Js::OpCode::LdMethodFldCallI)
+    {
+        // Only the interpreter runs the call with the load. The StartCall, ArgOut_A and CallI that follow
+        // are built from their own byte code.
+        newOpcode = Js::OpCode::LdMethodFld;
+    }
+
     propertyId = m_func->GetJITFunctionBody()->GetPropertyIdFromCacheId(inlineCacheIndex);
 
     IR::SymOpnd *   fieldSymOpnd = this->BuildFieldOpnd(newOpcode, instance, propertyId, (Js::PropertyIdIndexType)-1, PropertyKindData, inlineCacheIndex);
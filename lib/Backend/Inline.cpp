@@ -672,6 +672,13 @@ Inline::InlinePolymorphicFunctionUsingFixedMethods(IR::Instr *callInstr, const F
         return instrNext;
     }
 
+    if (inlineeJitTimeData->HasPolymorphicTail())
+    {
+        // The fixed method dispatch bails out on any other target, the other targets of a megamorphic call site are
+        // called out of line instead.
+        return InlinePolymorphicFunction(callInstr, inlinerData, symCallerThis, profileId, pIsInlined, recursiveInlineDepth, true);
+    }
+
     *pIsInlined = true;
 
     IR::Instr* tmpInstr = callInstr->m_prev;
@@ -1036,7 +1043,18 @@ Inline::InlinePolymorphicFunction(IR::Instr *callInstr, const FunctionJITTimeInf
             IR::AddrOpnd::New(inlineesDataArray[i]->GetFunctionInfoAddr(), IR::AddrOpndKindDynamicFunctionBody, dispatchStartLabel->m_func), dispatchStartLabel->m_func));
     }
 
-    CompletePolymorphicInlining(callInstr, returnValueOpnd, doneLabel, dispatchStartLabel, /*ldMethodFldInstr*/nullptr, IR::BailOutOnPolymorphicInlineFunction);
+    if (inlineeJitTimeData->HasPolymorphicTail())
+    {
+        // Only the most called targets were inlined, the others are expected and should not cause a bailout and rejit.
+        // The profile only records a tail under -MegamorphicInline, so this also covers out of process JIT.
+        POLYMORPHIC_INLINE_TESTTRACE(_u("INLINING (Polymorphic): Megamorphic call site, calling the other targets out of line:\tCaller: %s (%s)\n"),
+                    inlinerData->GetBody()->GetDisplayName(), inlinerData->GetDebugNumberSet(debugStringBuffer2));
+        CompletePolymorphicInliningWithTailCall(callInstr, returnValueOpnd, doneLabel, dispatchStartLabel);
+    }
+    else
+    {
+        CompletePolymorphicInlining(callInstr, returnValueOpnd, doneLabel, dispatchStartLabel, /*ldMethodFldInstr*/nullptr, IR::BailOutOnPolymorphicInlineFunction);
+    }
 
     this->topFunc->SetHasInlinee();
     InsertStatementBoundary(instrNext);
@@ -1094,6 +1112,34 @@ void Inline::CompletePolymorphicInlining(IR::Instr* callInstr, IR::RegOpnd* retu
     callInstr->Remove(); // We don't need callInstr anymore.
 }
 
+void Inline::CompletePolymorphicInliningWithTailCall(IR::Instr* callInstr, IR::RegOpnd* returnValueOpnd, IR::LabelInstr* doneLabel, IR::Instr* dispatchStartLabel)
+{
+    // Label $tail:
+    // returnValueOpnd = CallI methodOpnd, clonedArgs
+    // Label $done:
+    IR::LabelInstr* tailLabel = IR::LabelInstr::New(Js::OpCode::Label, callInstr->m_func);
+    callInstr->InsertBefore(tailLabel);
+    dispatchStartLabel->InsertBefore(IR::BranchInstr::New(Js::OpCode::Br, tailLabel, callInstr->m_func));
+
+    IR::Instr* tailCallInstr = IR::Instr::New(callInstr->m_opcode, callInstr->m_func);
+    tailCallInstr->SetSrc1(callInstr->GetSrc1());
+    if (returnValueOpnd)
+    {
+        tailCallInstr->SetDst(returnValueOpnd);
+    }
+    tailCallInstr->SetIsCloned(true);
+    callInstr->InsertBefore(tailCallInstr);
+    this->CloneCallSequence(callInstr, tailCallInstr);
+
+    // Remove the original args
+    callInstr->IterateArgInstrs([&](IR::Instr* argInstr) {
+        argInstr->Remove();
+        return false;
+    });
+    callInstr->InsertBefore(doneLabel);
+    callInstr->Remove(); // We don't need callInstr anymore.
+}
+
 //
 // Inlines a function if it is a polymorphic inlining candidate.
 // otherwise introduces a call to it.
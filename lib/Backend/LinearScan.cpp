@@ -3170,7 +3170,7 @@ LinearScan::AllocateStackSpace(Lifetime *spilledRange)
 
     StackSlot * newStackSlot = nullptr;
 
-    if (!PHASE_OFF(Js::StackPackPhase, this->func) && !this->func->IsJitInDebugMode() && !spilledRange->cantStackPack)
+    if (!PHASE_OFF(Js::StackPackPhase, this->func) && !this->isFastRegAlloc && !this->func->IsJitInDebugMode() && !spilledRange->cantStackPack)
     {
         // Search for a free stack slot to re-use
         FOREACH_SLIST_ENTRY_EDITING(StackSlot *, slot, this->stackSlotsFreeList, iter)
@@ -4476,7 +4476,7 @@ void LinearScan::AvoidCompensationConflicts(IR::LabelInstr *labelInstr, IR::Bran
 RegNum
 LinearScan::SecondChanceAllocation(Lifetime *lifetime, bool force)
 {
-    if (PHASE_OFF(Js::SecondChancePhase, this->func) || this->func->HasTry())
+    if (PHASE_OFF(Js::SecondChancePhase, this->func) || this->isFastRegAlloc || this->func->HasTry())
     {
         return RegNOREG;
     }
@@ -4711,7 +4711,7 @@ IR::Instr * LinearScan::TryHoistLoad(IR::Instr *instr, Lifetime *lifetime)
     RegNum reg = lifetime->reg;
     IR::Instr *insertInstr = instr;
 
-    if (PHASE_OFF(Js::RegHoistLoadsPhase, this->func))
+    if (PHASE_OFF(Js::RegHoistLoadsPhase, this->func) || this->isFastRegAlloc)
     {
         return insertInstr;
     }
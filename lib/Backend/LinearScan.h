@@ -94,6 +94,8 @@ private:
     SList<Lifetime *> * stackPackInUseLiveRanges;
     SList<StackSlot *> *stackSlotsFreeList;
     LoweredBasicBlock  *currentBlock;
+    // Simple JIT code is short lived, so skip the allocation refinements that only improve code quality
+    const bool          isFastRegAlloc;
 #if DBG
     BitVector           nonAllocatableRegs;
 #endif
@@ -102,7 +104,8 @@ public:
         linearScanMD(func), opHelperSpilledLiveranges(NULL), currentOpHelperBlock(NULL),
         lastLabel(NULL), numInt32Regs(0), numFloatRegs(0), stackPackInUseLiveRanges(NULL), stackSlotsFreeList(NULL),
         totalOpHelperFullVisitedLength(0), curLoop(NULL), currentBlock(nullptr), currentRegion(nullptr), m_bailOutRecordCount(0),
-        globalBailOutRecordTables(nullptr), lastUpdatedRowIndices(nullptr)
+        globalBailOutRecordTables(nullptr), lastUpdatedRowIndices(nullptr),
+        isFastRegAlloc(func->IsSimpleJit() && !PHASE_OFF(Js::FastRegAllocPhase, func))
     {
     }
 
@@ -1637,6 +1637,8 @@ Lowerer::LowerRange(IR::Instr *instrStart, IR::Instr *instrEnd, bool defaultDoFa
 
         case Js::OpCode::Memset:
         case Js::OpCode::Memcopy:
+        case Js::OpCode::Memadd:
+        case Js::OpCode::Memmul:
         {
             instrPrev = LowerMemOp(instr);
             break;
@@ -9190,7 +9192,21 @@ Lowerer::LowerMemset(IR::Instr * instr, IR::RegOpnd * helperRet)
     Assert(sizeOpnd);
     Assert(indexOpnd);
 
-    IR::JnHelperMethod helperMethod = IR::HelperOp_Memset;
+    // Memadd and Memmul take the same operands as Memset and update the range in place
+    IR::JnHelperMethod helperMethod;
+    switch (instr->m_opcode)
+    {
+    case Js::OpCode::Memadd:
+        helperMethod = IR::HelperOp_Memadd;
+        break;
+    case Js::OpCode::Memmul:
+        helperMethod = IR::HelperOp_Memmul;
+        break;
+    default:
+        Assert(instr->m_opcode == Js::OpCode::Memset);
+        helperMethod = IR::HelperOp_Memset;
+        break;
+    }
     IR::Instr *instrPrev = nullptr;
     if (src1->IsRegOpnd() && !src1->IsVar())
     {
@@ -9253,7 +9269,8 @@ Lowerer::LowerMemcopy(IR::Instr * instr, IR::RegOpnd * helperRet)
 IR::Instr *
 Lowerer::LowerMemOp(IR::Instr * instr)
 {
-    Assert(instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy);
+    Assert(instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy ||
+        instr->m_opcode == Js::OpCode::Memadd || instr->m_opcode == Js::OpCode::Memmul);
     IR::Instr *instrPrev = instr->m_prev;
 
     IR::RegOpnd* helperRet = IR::RegOpnd::New(TyInt8, instr->m_func);
@@ -9311,13 +9328,13 @@ Lowerer::LowerMemOp(IR::Instr * instr)
     }
 
     IR::Instr* newInstrPrev = nullptr;
-    if (instr->m_opcode == Js::OpCode::Memset)
+    if (instr->m_opcode == Js::OpCode::Memcopy)
     {
-        newInstrPrev = LowerMemset(instr, helperRet);
+        newInstrPrev = LowerMemcopy(instr, helperRet);
     }
-    else if (instr->m_opcode == Js::OpCode::Memcopy)
+    else
     {
-        newInstrPrev = LowerMemcopy(instr, helperRet);
+        newInstrPrev = LowerMemset(instr, helperRet);
     }
 
     if (newInstrPrev != nullptr)
@@ -12443,7 +12460,8 @@ void Lowerer::LowerBailOnInvalidatedArrayHeadSegment(IR::Instr *const instr, con
     */
 
     Assert(instr);
-    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy);
+    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy ||
+        instr->m_opcode == Js::OpCode::Memadd || instr->m_opcode == Js::OpCode::Memmul);
     Assert(instr->GetDst());
     Assert(instr->GetDst()->IsIndirOpnd());
 
@@ -12570,7 +12588,8 @@ void Lowerer::LowerBailOnInvalidatedArrayLength(IR::Instr *const instr, const bo
     */
 
     Assert(instr);
-    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy);
+    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy ||
+        instr->m_opcode == Js::OpCode::Memadd || instr->m_opcode == Js::OpCode::Memmul);
     Assert(instr->GetDst());
     Assert(instr->GetDst()->IsIndirOpnd());
 
@@ -12657,7 +12676,8 @@ void Lowerer::LowerBailOnCreatedMissingValue(IR::Instr *const instr, const bool
     */
 
     Assert(instr);
-    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy);
+    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy ||
+        instr->m_opcode == Js::OpCode::Memadd || instr->m_opcode == Js::OpCode::Memmul);
     Assert(instr->GetDst());
     Assert(instr->GetDst()->IsIndirOpnd());
 
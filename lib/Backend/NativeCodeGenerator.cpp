@@ -102,18 +102,21 @@ NativeCodeGenerator::~NativeCodeGenerator()
     }
 
 
-    if (this->backgroundAllocators)
+    while (this->backgroundAllocators)
     {
+        BackgroundAllocators * entry = this->backgroundAllocators;
+        this->backgroundAllocators = entry->next;
 #if DBG
         // PageAllocator is thread agile. This destructor can be called from background GC thread.
         // We have already removed this manager from the job queue and hence its fine to set the threadId to -1.
         // We can't DissociatePageAllocator here as its allocated ui thread.
         //this->Processor()->DissociatePageAllocator(allocator->GetPageAllocator());
-        this->backgroundAllocators->ClearConcurrentThreadId();
+        entry->allocators->ClearConcurrentThreadId();
 #endif
         // The native code generator may be deleted after Close was called on the job processor. In that case, the
         // background thread is no longer running, so clean things up in the foreground.
-        HeapDelete(this->backgroundAllocators);
+        HeapDelete(entry->allocators);
+        HeapDelete(entry);
     }
 
 #ifdef PROFILE_EXEC
@@ -170,10 +173,11 @@ void NativeCodeGenerator::Close()
 
     // Only decommit here instead of releasing the memory, so we retain control over these addresses
     // Mitigate against the case the entry point is called after the script site is closed
-    if (this->backgroundAllocators)
+    ForEachBackgroundAllocators([](CodeGenAllocators * allocators)
     {
-        this->backgroundAllocators->emitBufferManager.Decommit();
-    }
+        allocators->emitBufferManager.Decommit();
+        return false;
+    });
 
     if (this->foregroundAllocators)
     {
@@ -913,8 +917,17 @@ NativeCodeGenerator::CodeGen(PageAllocator * pageAllocator, CodeGenWorkItem* wor
     else
     {
         CodeGenAllocators *const allocators =
-            foreground ? EnsureForegroundAllocators(pageAllocator) : GetBackgroundAllocator(pageAllocator); // okay to do outside lock since the respective function is called only from one thread
-        NoRecoverMemoryJitArenaAllocator jitArena(_u("JITArena"), pageAllocator, Js::Throw::OutOfMemory);
+            foreground ? EnsureForegroundAllocators(pageAllocator) : GetBackgroundAllocator(pageAllocator); // okay to do outside lock since each thread has its own allocators
+
+        // The JIT arena only lives for this work item, take its pages from the process-wide pool so that
+        // they stay warm across work items, threads and runtimes
+        AutoReturnPageAllocator autoReturnPageAllocator;
+        PageAllocator * jitArenaPageAllocator = pageAllocator;
+        if (PageAllocatorPool::CanUseForPolicy(scriptContext->GetThreadContext()->GetAllocationPolicyManager()))
+        {
+            jitArenaPageAllocator = autoReturnPageAllocator.GetPageAllocator();
+        }
+        NoRecoverMemoryJitArenaAllocator jitArena(_u("JITArena"), jitArenaPageAllocator, Js::Throw::OutOfMemory);
 #if DBG
         jitArena.SetNeedsDelayFreeList();
 #endif
@@ -1639,6 +1652,13 @@ NativeCodeGenerator::CheckCodeGenDone(
         jsMethod = entryPointInfo->jsMethod;
 
         Assert(!functionBody->NeedEnsureDynamicProfileInfo() || jsMethod == Js::DynamicProfileInfo::EnsureDynamicProfileInfoThunk);
+
+#if ENABLE_JIT_WARMUP_CACHE
+        if (entryPointInfo->GetJitMode() == ExecutionMode::FullJit && !functionBody->GetIsAsmjsMode())
+        {
+            Js::JitWarmupCache::RecordFullJit(functionBody);
+        }
+#endif
     }
 
     Assert(!IsThunk(jsMethod));
@@ -1845,6 +1865,13 @@ NativeCodeGenerator::Prioritize(JsUtil::Job *const job, const bool forceAddJobTo
 
         jitMode = functionBody->GetExecutionMode();
         Assert(jitMode == ExecutionMode::SimpleJit || jitMode == ExecutionMode::FullJit);
+
+        if(!forceAddJobToProcessor &&
+            CONFIG_FLAG_RELEASE(AdaptiveTierUp) &&
+            !functionBody->AdaptTierUpToJitQueue(queuedFullJitWorkItemCount))
+        {
+            return;
+        }
     }
 
     workItems.Unlink(workItem);
@@ -2637,8 +2664,12 @@ NativeCodeGenerator::GatherCodeGenData(
             //We should be able to inline at least two functions here.
             if (polyInlineeCount >= 2)
             {
-                for (uint id = 0; id < polyInlineeCount; id++)
+                // Megamorphic call sites list their targets from the most called. The inlinees are chained in reverse and
+                // dispatched in chain order, so add them from the least called to have the most called one tested first.
+                const bool hasPolymorphicTail = profileData->IsMegamorphicCallSite(profiledCallSiteId);
+                for (uint i = 0; i < polyInlineeCount; i++)
                 {
+                    const uint id = hasPolymorphicTail ? polyInlineeCount - 1 - i : i;
                     bool isInlined = canInlineArray[id];
 
                     Js::FunctionCodeGenRuntimeData  *inlineeRunTimeData = IsInlinee ? runtimeData->EnsureInlinee(recycler, profiledCallSiteId, inlineeFunctionBodyArray[id]) : functionBody->EnsureInlineeCodeGenRuntimeData(recycler, profiledCallSiteId, inlineeFunctionBodyArray[id]);
@@ -2646,6 +2677,10 @@ NativeCodeGenerator::GatherCodeGenData(
                     if (!isJitTimeDataComputed)
                     {
                         Js::FunctionCodeGenJitTimeData  *inlineeJitTimeData = jitTimeData->AddInlinee(recycler, profiledCallSiteId, inlineeFunctionBodyArray[id]->GetFunctionInfo(), isInlined);
+                        if (hasPolymorphicTail)
+                        {
+                            inlineeJitTimeData->SetHasPolymorphicTail();
+                        }
                         if (isInlined)
                         {
                             GatherCodeGenData<true>(
@@ -3154,7 +3189,11 @@ NativeCodeGenerator::FreeNativeCodeGenAllocation(void* address)
         }
         else
         {
-            this->backgroundAllocators->emitBufferManager.FreeAllocation(address);
+            // Any of the background threads may have emitted the code
+            ForEachBackgroundAllocators([address](CodeGenAllocators * allocators)
+            {
+                return allocators->emitBufferManager.FreeAllocation(address);
+            });
         }
     }
 }
@@ -152,7 +152,16 @@ private:
 
     CodeGenAllocators * GetBackgroundAllocator(PageAllocator *pageAllocator)
     {
-        return this->backgroundAllocators;
+        // Each job processor thread has its own allocators, keyed by the thread's page allocator
+        for (BackgroundAllocators * entry = this->backgroundAllocators; entry != nullptr; entry = entry->next)
+        {
+            if (entry->threadPageAllocator == pageAllocator)
+            {
+                return entry->allocators;
+            }
+        }
+        Assert(false);
+        return nullptr;
     }
 
     Js::ScriptContextProfiler * GetBackgroundCodeGenProfiler(PageAllocator *allocator);
@@ -161,17 +170,46 @@ private:
 
     void AllocateBackgroundAllocators(PageAllocator * pageAllocator)
     {
-        if (!this->backgroundAllocators)
+        // Called for every job processor thread when this manager is added to the processor, so that concurrent
+        // background JIT threads don't contend on a single set of allocators
+        for (BackgroundAllocators * entry = this->backgroundAllocators; entry != nullptr; entry = entry->next)
         {
-            this->backgroundAllocators = CreateAllocators(pageAllocator);
+            if (entry->threadPageAllocator == pageAllocator)
+            {
+                return;
+            }
+        }
+
+        CodeGenAllocators * allocators = CreateAllocators(pageAllocator);
 #if !_M_X64_OR_ARM64 && _CONTROL_FLOW_GUARD
-            this->backgroundAllocators->canCreatePreReservedSegment = true;
+        allocators->canCreatePreReservedSegment = true;
 #endif
+        BackgroundAllocators * entry = HeapNewNoThrowStruct(BackgroundAllocators);
+        if (entry == nullptr)
+        {
+            HeapDelete(allocators);
+            Js::Throw::OutOfMemory();
         }
+        entry->threadPageAllocator = pageAllocator;
+        entry->allocators = allocators;
+        entry->next = this->backgroundAllocators;
+        this->backgroundAllocators = entry;
 
         AllocateBackgroundCodeGenProfiler(pageAllocator);
     }
 
+    template <class Fn>
+    void ForEachBackgroundAllocators(Fn fn)
+    {
+        for (BackgroundAllocators * entry = this->backgroundAllocators; entry != nullptr; entry = entry->next)
+        {
+            if (fn(entry->allocators))
+            {
+                break;
+            }
+        }
+    }
+
     virtual void ProcessorThreadSpecificCallBack(PageAllocator * pageAllocator) override
     {
         AllocateBackgroundAllocators(pageAllocator);
@@ -311,8 +349,15 @@ private:
 
     FreeLoopBodyJobManager freeLoopBodyManager;
 
+    struct BackgroundAllocators
+    {
+        PageAllocator * threadPageAllocator;
+        CodeGenAllocators * allocators;
+        BackgroundAllocators * next;
+    };
+
     CodeGenAllocators * foregroundAllocators;
-    CodeGenAllocators * backgroundAllocators;
+    BackgroundAllocators * backgroundAllocators;
 #ifdef PROFILE_EXEC
     Js::ScriptContextProfiler * foregroundCodeGenProfiler;
     Js::ScriptContextProfiler * backgroundCodeGenProfiler;
@@ -5,8 +5,10 @@
 
 #include "Backend.h"
 
+#if ENABLE_NATIVE_CODEGEN
 #if ENABLE_OOP_NATIVE_CODEGEN
 #include "JITServer/JITServer.h"
+#endif
 #include "PageAllocatorPool.h"
 
 CriticalSection PageAllocatorPool::cs;
@@ -14,9 +16,12 @@ PageAllocatorPool* PageAllocatorPool::Instance = nullptr;
 
 PageAllocatorPool::PageAllocatorPool()
     :pageAllocators(&NoThrowHeapAllocator::Instance),
-    activePageAllocatorCount(0)
+    activePageAllocatorCount(0),
+    inactiveFreePageCount(0)
 {
+#if ENABLE_OOP_NATIVE_CODEGEN
     idleCleanupTimer = CreateWaitableTimerEx(NULL, L"JITServerIdle", 0/*auto reset*/, TIMER_ALL_ACCESS);
+#endif
 }
 
 PageAllocatorPool::~PageAllocatorPool()
@@ -27,6 +32,13 @@ PageAllocatorPool::~PageAllocatorPool()
 
 void PageAllocatorPool::Initialize()
 {
+    AutoCriticalSection autoCS(&cs);
+    if (Instance != nullptr)
+    {
+        // Both the JIT server and the in-proc runtime initialize the pool when they share a process
+        return;
+    }
+
     Instance = HeapNewNoThrow(PageAllocatorPool);
     if (Instance == nullptr)
     {
@@ -36,15 +48,16 @@ void PageAllocatorPool::Initialize()
 void PageAllocatorPool::Shutdown()
 {
     AutoCriticalSection autoCS(&cs);
-    Assert(Instance);
     if (Instance)
     {
         PageAllocatorPool* localInstance = Instance;
         Instance = nullptr;
+#if ENABLE_OOP_NATIVE_CODEGEN
         if (localInstance->idleCleanupTimer)
         {
             CloseHandle(localInstance->idleCleanupTimer);
         }
+#endif
         HeapDelete(localInstance);
     }
 }
@@ -55,6 +68,14 @@ void PageAllocatorPool::RemoveAll()
     {
         HeapDelete(pageAllocators.Pop());
     }
+    inactiveFreePageCount = 0;
+}
+
+bool PageAllocatorPool::CanUseForPolicy(AllocationPolicyManager * policyManager)
+{
+    // Pages handed out by the pool are shared by every runtime in the process, so they can't be
+    // reported to a runtime with a memory limit or an allocation callback.
+    return CONFIG_FLAG_RELEASE(ArenaPagePool) && (policyManager == nullptr || policyManager->IsUnrestricted());
 }
 
 unsigned int PageAllocatorPool::GetInactivePageAllocatorCount()
@@ -63,15 +84,53 @@ unsigned int PageAllocatorPool::GetInactivePageAllocatorCount()
     return pageAllocators.Count();
 }
 
+PageAllocator* PageAllocatorPool::GetPooledPageAllocator()
+{
+    AutoCriticalSection autoCS(&cs);
+    if (Instance)
+    {
+        return Instance->GetPageAllocator();
+    }
+
+    // The pool has been shut down, hand out an allocator that is deleted on return
+    return HeapNew(PageAllocator, nullptr, Js::Configuration::Global.flags, PageAllocatorType_BGJIT,
+        AutoSystemInfo::Data.IsLowMemoryProcess() ? PageAllocator::DefaultLowMaxFreePageCount : PageAllocator::DefaultMaxFreePageCount);
+}
+
+void PageAllocatorPool::ReturnPooledPageAllocator(PageAllocator* pageAllocator)
+{
+    AutoCriticalSection autoCS(&cs);
+    if (Instance)
+    {
+        Instance->ReturnPageAllocator(pageAllocator);
+    }
+    else
+    {
+        HeapDelete(pageAllocator);
+    }
+}
+
 PageAllocator* PageAllocatorPool::GetPageAllocator()
 {
     AutoCriticalSection autoCS(&cs);
     PageAllocator* pageAllocator = nullptr;
     if (pageAllocators.Count() > 0)
     {
-        // TODO: OOP JIT, select the page allocator with right count of free pages
-        // base on some heuristic
-        pageAllocator = this->pageAllocators.Pop();
+        // Hand out the allocator with the most committed free pages so the warm pages get reused first
+        SList<PageAllocator*, NoThrowHeapAllocator, RealCount>::EditingIterator iter(&this->pageAllocators);
+        SList<PageAllocator*, NoThrowHeapAllocator, RealCount>::EditingIterator warmest;
+        while (iter.Next())
+        {
+            if (pageAllocator == nullptr || iter.Data()->GetFreePageCount() > pageAllocator->GetFreePageCount())
+            {
+                pageAllocator = iter.Data();
+                warmest = iter;
+            }
+        }
+        warmest.RemoveCurrent();
+
+        Assert(inactiveFreePageCount >= pageAllocator->GetFreePageCount());
+        inactiveFreePageCount -= pageAllocator->GetFreePageCount();
     }
     else
     {
@@ -86,20 +145,41 @@ PageAllocator* PageAllocatorPool::GetPageAllocator()
 void PageAllocatorPool::ReturnPageAllocator(PageAllocator* pageAllocator)
 {
     AutoCriticalSection autoCS(&cs);
-    if (!this->pageAllocators.PrependNoThrow(&HeapAllocator::Instance, pageAllocator))
+
+    activePageAllocatorCount--;
+    if (GetInactivePageAllocatorCount() >= (uint)Js::Configuration::Global.flags.JITServerMaxInactivePageAllocatorCount)
     {
         HeapDelete(pageAllocator);
     }
+    else
+    {
+        // Keep the returned pages committed as long as the pool stays within its warm page budget
+        if (inactiveFreePageCount + pageAllocator->GetFreePageCount() > (size_t)CONFIG_FLAG_RELEASE(ArenaPagePoolMaxFreePageCount))
+        {
+            pageAllocator->DecommitNow();
+        }
+
+        if (this->pageAllocators.PrependNoThrow(&HeapAllocator::Instance, pageAllocator))
+        {
+            inactiveFreePageCount += pageAllocator->GetFreePageCount();
+        }
+        else
+        {
+            HeapDelete(pageAllocator);
+        }
+    }
 
-    activePageAllocatorCount--;
-    if (activePageAllocatorCount == 0 || GetInactivePageAllocatorCount() > (uint)Js::Configuration::Global.flags.JITServerMaxInactivePageAllocatorCount)
+#if ENABLE_OOP_NATIVE_CODEGEN
+    if (JITManager::GetJITManager()->IsJITServer() && activePageAllocatorCount == 0)
     {
         PageAllocatorPool::IdleCleanup();
     }
+#endif
 }
 
 void PageAllocatorPool::IdleCleanup()
 {
+#if ENABLE_OOP_NATIVE_CODEGEN
     AutoCriticalSection autoCS(&cs);
     if (Instance)
     {
@@ -112,8 +192,10 @@ void PageAllocatorPool::IdleCleanup()
             Instance->RemoveAll();
         }
     }
+#endif
 }
 
+#if ENABLE_OOP_NATIVE_CODEGEN
 VOID CALLBACK PageAllocatorPool::IdleCleanupRoutine(
     _In_opt_ LPVOID lpArgToCompletionRoutine,
     _In_     DWORD  dwTimerLowValue,
@@ -128,3 +210,4 @@ VOID CALLBACK PageAllocatorPool::IdleCleanupRoutine(
     }
 }
 #endif
+#endif
@@ -5,6 +5,10 @@
 
 #pragma once
 
+// Process-wide pool of thread agile page allocators. Short lived arenas (JIT work items, deferred parses)
+// borrow an allocator for their lifetime so that the pages they release stay committed for the next user
+// instead of going back to the OS. The number of warm pages kept by inactive allocators is bounded by
+// -ArenaPagePoolMaxFreePageCount.
 class PageAllocatorPool
 {
     friend class AutoReturnPageAllocator;
@@ -16,12 +20,20 @@ public:
     static void Initialize();
     static void Shutdown();
     static void IdleCleanup();
+
+    // Pooled page allocators are not charged to any AllocationPolicyManager
+    static bool CanUseForPolicy(AllocationPolicyManager * policyManager);
 private:
 
+#if ENABLE_OOP_NATIVE_CODEGEN
     static VOID CALLBACK IdleCleanupRoutine(
         _In_opt_ LPVOID lpArgToCompletionRoutine,
         _In_     DWORD  dwTimerLowValue,
         _In_     DWORD  dwTimerHighValue);
+#endif
+
+    static PageAllocator* GetPooledPageAllocator();
+    static void ReturnPooledPageAllocator(PageAllocator* pageAllocator);
 
     PageAllocator* GetPageAllocator();
     void ReturnPageAllocator(PageAllocator* pageAllocator);
@@ -30,8 +42,11 @@ private:
     SList<PageAllocator*, NoThrowHeapAllocator, RealCount> pageAllocators;
     static CriticalSection cs;
     static PageAllocatorPool* Instance;
+#if ENABLE_OOP_NATIVE_CODEGEN
     HANDLE idleCleanupTimer;
+#endif
     volatile unsigned long long activePageAllocatorCount;
+    size_t inactiveFreePageCount;
 };
 
 class AutoReturnPageAllocator
@@ -42,14 +57,14 @@ public:
     {
         if (pageAllocator)
         {
-            PageAllocatorPool::Instance->ReturnPageAllocator(pageAllocator);
+            PageAllocatorPool::ReturnPooledPageAllocator(pageAllocator);
         }
     }
     PageAllocator* GetPageAllocator()
     {
         if (pageAllocator == nullptr)
         {
-            pageAllocator = PageAllocatorPool::Instance->GetPageAllocator();
+            pageAllocator = PageAllocatorPool::GetPooledPageAllocator();
         }
 
         return pageAllocator;
@@ -45,6 +45,7 @@ typedef double  FloatConstType;
 #include "BackendOpCodeAttr.h"
 #include "BackendOpCodeAttrAsmJs.h"
 #include "CodeGenNumberAllocator.h"
+#include "PageAllocatorPool.h"
 #include "NativeCodeData.h"
 #include "JnHelperMethod.h"
 #include "IRType.h"
@@ -484,9 +484,9 @@ namespace JsUtil
 
     void BackgroundJobProcessor::InitializeThreadCount()
     {
-        if (CONFIG_FLAG(ForceMaxJitThreadCount))
+        if (CONFIG_FLAG_RELEASE(ForceMaxJitThreadCount))
         {
-            this->maxThreadCount = CONFIG_FLAG(MaxJitThreadCount);
+            this->maxThreadCount = CONFIG_FLAG_RELEASE(MaxJitThreadCount);
         }
         else if (AutoSystemInfo::Data.IsLowMemoryProcess())
         {
@@ -498,8 +498,11 @@ namespace JsUtil
             int processorCount = AutoSystemInfo::Data.GetNumberOfPhysicalProcessors();
             //There is 2 threads already in play, one UI (main) thread and a GC thread. So subtract 2 from processorCount to account for the same.
 
-            this->maxThreadCount = max(1, min(processorCount - 2, CONFIG_FLAG(MaxJitThreadCount)));
+            this->maxThreadCount = max(1, min(processorCount - 2, CONFIG_FLAG_RELEASE(MaxJitThreadCount)));
         }
+
+        // Every thread has its own page allocator, and every native code generator keeps code gen allocators per thread
+        this->maxThreadCount = max(1u, min(this->maxThreadCount, (unsigned int)MaxThreadCount));
     }
 
     void BackgroundJobProcessor::InitializeParallelThreadData(AllocationPolicyManager* policyManager, bool disableParallelThreads)
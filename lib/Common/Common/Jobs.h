@@ -457,6 +457,8 @@ namespace JsUtil
         unsigned int maxThreadCount;
         ParallelThreadData **parallelThreadData;
 
+        static const unsigned int MaxThreadCount = 16;
+
 #if DBG_DUMP
         static  char16 const * const  DebugThreadNames[16];
 #endif
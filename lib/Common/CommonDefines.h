@@ -145,6 +145,17 @@
 #error "Background page zeroing can't be turned on if freeing pages in the background is disabled"
 #endif
 
+// Recycler page segments backed by 2MB transparent huge pages (build.sh --huge-page-segments, then
+// opt-in with -RecyclerHugePageSegments). Building it in doubles the page bit vectors of every page
+// segment, so it is off by default. The PAL maps MEM_LARGE_PAGES reservations to madvise(MADV_HUGEPAGE);
+// Windows large pages need the lock memory privilege and can't be decommitted, so they are not used there.
+#if ENABLE_HUGE_PAGE_SEGMENTS && (defined(_WIN32) || !defined(_M_X64_OR_ARM64))
+#undef ENABLE_HUGE_PAGE_SEGMENTS
+#endif
+#ifndef ENABLE_HUGE_PAGE_SEGMENTS
+#define ENABLE_HUGE_PAGE_SEGMENTS 0
+#endif
+
 #define BUCKETIZE_MEDIUM_ALLOCATIONS 1              // *** TODO: Won't build if disabled currently
 #define SMALLBLOCK_MEDIUM_ALLOC 1                   // *** TODO: Won't build if disabled currently
 #define LARGEHEAPBLOCK_ENCODING 1                   // Large heap block metadata encoding
@@ -187,9 +198,20 @@
 #endif
 #endif
 
+#if ENABLE_NATIVE_CODEGEN && ENABLE_PROFILE_INFO
+#define ENABLE_JIT_WARMUP_CACHE 1       // Persist full JIT tier-up decisions across runs (-JitWarmupCacheDir)
+#define DYNAMIC_PROFILE_SERIALIZATION   // Save/load per source profile records (JsSerializeProfile/JsLoadProfile)
+#endif
+
 // Other features
 // #define CHAKRA_CORE_DOWN_COMPAT 1
 
+// Interpreter dispatch through a table of label addresses (build.sh --threaded-interpreter).
+// Labels as values are a GNU extension, so other compilers keep the switch.
+#if ENABLE_THREADED_INTERPRETER_DISPATCH && !defined(__GNUC__) && !defined(__clang__)
+#undef ENABLE_THREADED_INTERPRETER_DISPATCH
+#endif
+
 // VS2015 RTM has bugs with constexpr, so require min of VS2015 Update 3 (known good version)
 #if !defined(_MSC_VER) || _MSC_FULL_VER >= 190024210
 #define HAS_CONSTEXPR 1
@@ -508,6 +530,7 @@
 // #define OLD_ITRACKER                 // Switch to the old IE8 ITracker GUID
 // #define LOG_BYTECODE_AST_RATIO       // log the ratio between AST size and bytecode generated.
 // #define DUMP_FRAGMENTATION_STATS        // Display HeapBucket fragmentation stats after sweep
+// #define RECYCLER_GEOMETRIC_SIZE_CLASSES // Round small and medium objects to four size classes per power of two
 
 // ----- Fretest or free build special build features (already enabled in debug builds) -----
 // #define TRACK_DISPATCH
@@ -185,6 +185,7 @@ PHASE(All)
                     PHASE(MarkTempNumber)
                     PHASE(MarkTempObject)
                     PHASE(MarkTempNumberOnTempObject)
+                PHASE(DeadTempObject)
         PHASE(Lowerer)
             PHASE(FastPath)
                 PHASE(LoopFastPath)
@@ -222,6 +223,7 @@ PHASE(All)
                 PHASE(RegionUseCount)
                 PHASE(RegHoistLoads)
                 PHASE(ClearRegLoopExit)
+                PHASE(FastRegAlloc)
         PHASE(Peeps)
         PHASE(Layout)
         PHASE(EHBailoutPatchUp)
@@ -263,8 +265,10 @@ PHASE(All)
                 PHASE(BackgroundRescan)
                 PHASE(BackgroundRepeatMark)
                 PHASE(BackgroundFinishMark)
+                PHASE(IncrementalMark)
             PHASE(ConcurrentPartialCollect)
             PHASE(ParallelMark)
+                PHASE(ParallelMarkWorkStealing)
             PHASE(PartialCollect)
                 PHASE(ResetMarks)
                 PHASE(ResetWriteWatch)
@@ -283,6 +287,7 @@ PHASE(All)
                     PHASE(SweepLarge)
                     PHASE(SweepPartialReuse)
                 PHASE(ConcurrentSweep)
+                    PHASE(ParallelSweep)
                 PHASE(Finalize)
                 PHASE(Dispose)
                 PHASE(FinishPartial)
@@ -316,11 +321,15 @@ PHASE(All)
 #endif
         PHASE(JITLoopBody)
         PHASE(JITLoopBodyInTryCatch)
+        PHASE(JITOuterLoopBody)
         PHASE(ReJIT)
         PHASE(ExecutionMode)
         PHASE(SimpleJitDynamicProfile)
         PHASE(SimpleJit)
         PHASE(FullJit)
+#if ENABLE_JIT_WARMUP_CACHE
+        PHASE(JitWarmupCache)
+#endif
         PHASE(FailNativeCodeInstall)
         PHASE(PixelArray)
         PHASE(Etw)
@@ -351,6 +360,7 @@ PHASE(All)
         PHASE(InterpreterProfile)
         PHASE(InterpreterAutoProfile)
         PHASE(ByteCodeConcatExprOpt)
+        PHASE(ByteCodeConstFold)
         PHASE(TraceInlineCacheInvalidation)
         PHASE(TracePropertyGuards)
 #ifdef ENABLE_JS_ETW
@@ -450,7 +460,7 @@ PHASE(All)
 #define DEFAULT_CONFIG_JitLoopBodyHotLoopThreshold (20000)
 #define DEFAULT_CONFIG_LoopBodySizeThresholdToDisableOpts (255)
 
-#define DEFAULT_CONFIG_MaxJitThreadCount        (2)
+#define DEFAULT_CONFIG_MaxJitThreadCount        (4)
 #define DEFAULT_CONFIG_ForceMaxJitThreadCount   (false)
 
 #ifdef RECYCLER_PAGE_HEAP
@@ -595,6 +605,8 @@ PHASE(All)
 #define DEFAULT_CONFIG_JitQueueThreshold      (6)
 
 #define DEFAULT_CONFIG_FullJitRequeueThreshold (25)     // Minimum number of times a function needs to be executed before it is re-added to the jit queue
+#define DEFAULT_CONFIG_AdaptiveTierUp          (false)
+#define DEFAULT_CONFIG_MegamorphicInline       (false)
 
 #define DEFAULT_CONFIG_MinTemplatizedJitRunCount      (100)     // Minimum number of times a function needs to be interpreted before it is jitted
 #define DEFAULT_CONFIG_MinAsmJsInterpreterRunCount      (10)     // Minimum number of times a function needs to be Asm interpreted before it is jitted
@@ -693,9 +705,17 @@ PHASE(All)
 #endif
 
 #define DEFAULT_CONFIG_RecyclerForceMarkInterior (false)
+#define DEFAULT_CONFIG_RecyclerMaxParallelism (4)
+#define DEFAULT_CONFIG_RecyclerIncrementalMarkBudget (0)
+#define DEFAULT_CONFIG_RecyclerNurserySize (0)
+#define DEFAULT_CONFIG_RecyclerHugePageSegments (false)
+#define DEFAULT_CONFIG_RecyclerSparseBlockThreshold (0)
 
 #define DEFAULT_CONFIG_MemProtectHeap (false)
 
+#define DEFAULT_CONFIG_ArenaPagePool (true)
+#define DEFAULT_CONFIG_ArenaPagePoolMaxFreePageCount (0x400)
+
 #define DEFAULT_CONFIG_InduceCodeGenFailure (30) // When -InduceCodeGenFailure is passed in, 30% of JIT allocations will fail
 
 #define DEFAULT_CONFIG_SkipSplitWhenResultIgnored (false)
@@ -862,6 +882,7 @@ FLAGNR(Boolean, CreateFunctionProxy   , "Create function proxies instead of full
 FLAGNR(Boolean, HybridFgJit           , "When background JIT is enabled, enable jitting in the foreground based on heuristics. This flag is only effective when OptimizeForManyInstances is disabled (UI threads).", DEFAULT_CONFIG_HybridFgJit)
 FLAGNR(Number,  HybridFgJitBgQueueLengthThreshold, "The background job queue length must exceed this threshold to consider jitting in the foreground", DEFAULT_CONFIG_HybridFgJitBgQueueLengthThreshold)
 FLAGNR(Boolean, BytecodeHist          , "Provide a histogram of the bytecodes run by the script. (NoNative required).", false)
+FLAGNR(Boolean, BytecodePairHist      , "Provide a histogram of the pairs of consecutive bytecodes run by the script, to choose superinstruction candidates. (NoNative required).", false)
 FLAGNR(Boolean, CurrentSourceInfo     , "Enable IASD get current script source info", DEFAULT_CONFIG_CurrentSourceInfo)
 FLAGNR(Boolean, CFGLog                , "Log CFG checks", false)
 FLAGNR(Boolean, CheckAlignment        , "Insert checks in the native code to verify 8-byte alignment of stack", false)
@@ -897,6 +918,9 @@ FLAGNR(Phases,  Dump                  , "What All to dump", )
 #ifdef DUMP_FRAGMENTATION_STATS
 FLAGR (Boolean, DumpFragmentationStats, "Dump bucket state after every GC", false)
 #endif
+#ifdef RECYCLER_STATS
+FLAGNR(Boolean, DumpAllocHistogram, "Dump the requested and rounded allocation sizes of each heap bucket when the recycler is destroyed", false)
+#endif
 FLAGNR(Boolean, DumpIRAddresses,   "Print addresses in IR dumps", false)
 FLAGNR(Boolean, DumpLineNoInColor, "Print the source code in high intensity color for better readability", false)
 #ifdef RECYCLER_DUMP_OBJECT_GRAPH
@@ -910,6 +934,9 @@ FLAGNRA(String, DynamicProfileCache   , Dpc, "File to cache dynamic profile info
 FLAGNR(String,  DynamicProfileCacheDir, "Directory to cache dynamic profile information", nullptr)
 FLAGNRA(String, DynamicProfileInput   , Dpi, "Read only file containing dynamic profile information", nullptr)
 #endif
+#if ENABLE_JIT_WARMUP_CACHE
+FLAGR (String,  JitWarmupCacheDir     , "Directory in which to remember the functions that reached full JIT, so that later runs full JIT them without the usual warm-up", nullptr)
+#endif
 #ifdef EDIT_AND_CONTINUE
 FLAGNR(Boolean, EditTest              , "Enable edit and continue test tools", false)
 #endif
@@ -1111,6 +1138,7 @@ FLAGNR(Boolean, GenerateByteCodeBufferReturnsCantGenerate, "Serialized byte code
 FLAGNR(Number, GoptCleanupThreshold, "Number of instructions seen before we cleanup the value table", DEFAULT_CONFIG_GoptCleanupThreshold)
 FLAGNR(Number, AsmGoptCleanupThreshold, "Number of instructions seen before we cleanup the value table", DEFAULT_CONFIG_AsmGoptCleanupThreshold)
 FLAGNR(Boolean, HighPrecisionDate, "Enable sub-millisecond resolution in Javascript Date for benchmark timing", DEFAULT_CONFIG_HighPrecisionDate)
+FLAGR (Boolean, MegamorphicInline     , "Keep the most called targets of call sites with more than four targets and inline them, calling the others out of line", DEFAULT_CONFIG_MegamorphicInline)
 FLAGNR(Number,  InlineCountMax        , "Maximum count in bytecodes to inline in a given function", DEFAULT_CONFIG_InlineCountMax)
 FLAGNRA(Number, InlineCountMaxInLoopBodies, icminlb, "Maximum count in bytecodes to inline in a given function", DEFAULT_CONFIG_InlineCountMaxInLoopBodies)
 FLAGNRA(Number, InlineInLoopBodyScaleDownFactor, iilbsdf, "Maximum depth of a recursive inline call", DEFAULT_CONFIG_InlineInLoopBodyScaleDownFactor)
@@ -1153,8 +1181,8 @@ FLAGNR(Boolean, ForceOldDateAPI       , "Force Chakra to use old dates API regar
 FLAGNR(Number,  JitLoopBodyHotLoopThreshold    , "Number of times loop has to be iterated in jitloopbody before it is determined as hot", DEFAULT_CONFIG_JitLoopBodyHotLoopThreshold)
 FLAGNR(Number,  LoopBodySizeThresholdToDisableOpts, "Minimum bytecode size of a loop body, above which we might consider switching off optimizations in jit loop body to avoid rejits", DEFAULT_CONFIG_LoopBodySizeThresholdToDisableOpts)
 
-FLAGNR(Number,  MaxJitThreadCount     , "Number of maximum allowed parallel jit threads (actual number is factor of number of processors and other heuristics)", DEFAULT_CONFIG_MaxJitThreadCount)
-FLAGNR(Boolean, ForceMaxJitThreadCount, "Force the number of parallel jit threads as specified by MaxJitThreadCount flag (creation guaranteed)", DEFAULT_CONFIG_ForceMaxJitThreadCount)
+FLAGR (Number,  MaxJitThreadCount     , "Number of maximum allowed parallel jit threads (actual number is factor of number of processors and other heuristics)", DEFAULT_CONFIG_MaxJitThreadCount)
+FLAGR (Boolean, ForceMaxJitThreadCount, "Force the number of parallel jit threads as specified by MaxJitThreadCount flag (creation guaranteed)", DEFAULT_CONFIG_ForceMaxJitThreadCount)
 
 FLAGNR(Number,  MinInterpretCount     , "Minimum number of times a function must be interpreted", 0)
 FLAGNR(Number,  MinSimpleJitRunCount  , "Minimum number of times a function must be run in simple jit", 0)
@@ -1180,9 +1208,11 @@ FLAGR (Number,  ProfilingInterpreter0Limit, "Limit after which to transition to
 FLAGR (Number,  AutoProfilingInterpreter1Limit, "Limit after which to transition to the next execution mode", DEFAULT_CONFIG_AutoProfilingInterpreter1Limit)
 FLAGR (Number,  SimpleJitLimit, "Limit after which to transition to the next execution mode", DEFAULT_CONFIG_SimpleJitLimit)
 FLAGR (Number,  ProfilingInterpreter1Limit, "Limit after which to transition to the next execution mode", DEFAULT_CONFIG_ProfilingInterpreter1Limit)
+FLAGR (Number,  MinSimpleJitIterations, "Minimum simple JIT limit below which simple JIT is skipped or no longer shortened by -AdaptiveTierUp", DEFAULT_CONFIG_MinSimpleJitIterations)
 
 FLAGNRA(String, ExecutionModeLimits,        Eml,  "Execution mode limits in th form: AutoProfilingInterpreter0.ProfilingInterpreter0.AutoProfilingInterpreter1.SimpleJit.ProfilingInterpreter1 - Example: -ExecutionModeLimits:12.4.0.132.12", _u(""))
 FLAGRA(Boolean, EnforceExecutionModeLimits, Eeml, "Enforces the execution mode limits such that they are never exceeded.", false)
+FLAGR (Boolean, AdaptiveTierUp, "Adjust the remaining execution mode limits of a function from its hotness, its bailouts and the length of the full JIT queue", DEFAULT_CONFIG_AdaptiveTierUp)
 
 FLAGNRA(Number, SimpleJitAfter        , Sja, "Number of calls to a function after which to simple-JIT the function", 0)
 FLAGNRA(Number, FullJitAfter          , Fja, "Number of calls to a function after which to full-JIT the function. The function will be profiled for every iteration.", 0)
@@ -1285,9 +1315,18 @@ FLAGNR(Boolean, RecyclerTrackStress, "Stress tracked object handling by simulati
 FLAGNR(Boolean, RecyclerInduceFalsePositives, "Stress recycler by forcing false positive object marks", false)
 #endif // RECYCLER_STRESS
 FLAGNR(Boolean, RecyclerForceMarkInterior, "Force all the mark as interior", DEFAULT_CONFIG_RecyclerForceMarkInterior)
+FLAGR (Number,  RecyclerSparseBlockThreshold, "Percentage of live objects below which a swept small heap block is allocated from last so it can drain and be released (0 = off)", DEFAULT_CONFIG_RecyclerSparseBlockThreshold)
 #if ENABLE_CONCURRENT_GC
 FLAGNR(Number,  RecyclerPriorityBoostTimeout, "Adjust priority boost timeout", 5000)
 FLAGNR(Number,  RecyclerThreadCollectTimeout, "Adjust thread collect timeout", 1000)
+FLAGR (Number,  RecyclerMaxParallelism, "Maximum number of threads (including the main and concurrent threads) to use for parallel mark (2~64)", DEFAULT_CONFIG_RecyclerMaxParallelism)
+FLAGR (Number,  RecyclerIncrementalMarkBudget, "Mark on the main thread in slices of at most this many microseconds instead of on the concurrent thread (0 = off)", DEFAULT_CONFIG_RecyclerIncrementalMarkBudget)
+#endif
+#if ENABLE_PARTIAL_GC
+FLAGR (Number,  RecyclerNurserySize, "Size in MB of new pages allocated before a partial (minor) collection is triggered in partial collect mode (0 = adaptive)", DEFAULT_CONFIG_RecyclerNurserySize)
+#endif
+#if ENABLE_HUGE_PAGE_SEGMENTS
+FLAGR (Boolean, RecyclerHugePageSegments, "Use 2MB page segments backed by transparent huge pages for the recycler heap block pages", DEFAULT_CONFIG_RecyclerHugePageSegments)
 #endif
 #ifdef RECYCLER_PAGE_HEAP
 FLAGNR(Number,      PageHeap,             "Use full page for heap allocations", DEFAULT_CONFIG_PageHeap)
@@ -1484,6 +1523,8 @@ FLAGNR(Boolean, CFG, "Force enable CFG on jshost. version in the jshost's manife
 
 FLAGR(Number, JITServerIdleTimeout, "Idle timeout in seconds to do the cleanup in JIT server", 10)
 FLAGR(Number, JITServerMaxInactivePageAllocatorCount, "Max inactive page allocators to keep before schedule a cleanup", 10)
+FLAGR(Boolean, ArenaPagePool, "Back JIT work item and deferred parse arenas with page allocators from the process-wide pool", DEFAULT_CONFIG_ArenaPagePool)
+FLAGR(Number, ArenaPagePoolMaxFreePageCount, "Max committed free pages kept by the inactive page allocators of the process-wide pool", DEFAULT_CONFIG_ArenaPagePoolMaxFreePageCount)
 #undef FLAG_REGOVR_EXP
 #undef FLAG_REGOVR_ASMJS
 
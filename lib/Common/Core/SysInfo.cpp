@@ -418,6 +418,34 @@ void AutoSystemInfo::SetAvailableCommit(ULONG64 commit)
     ::InterlockedCompareExchange64((volatile LONG64 *)&this->availableCommit, commit, 0);
 }
 
+DWORD AutoSystemInfo::GetCurrentNumaNode()
+{
+    ULONG highestNode = 0;
+    if (!::GetNumaHighestNodeNumber(&highestNode) || highestNode == 0)
+    {
+        return NUMA_NO_PREFERRED_NODE;
+    }
+
+    DWORD processor = ::GetCurrentProcessorNumber();
+    UCHAR node;
+    if (processor > UCHAR_MAX || !::GetNumaProcessorNode((UCHAR)processor, &node))
+    {
+        return NUMA_NO_PREFERRED_NODE;
+    }
+    return node;
+}
+
+bool AutoSystemInfo::SetCurrentThreadNumaAffinity(DWORD numaNode)
+{
+    ULONGLONG processorMask = 0;
+    if (numaNode > UCHAR_MAX || !::GetNumaNodeProcessorMask((UCHAR)numaNode, &processorMask) || processorMask == 0)
+    {
+        return false;
+    }
+
+    return ::SetThreadAffinityMask(::GetCurrentThread(), (DWORD_PTR)processorMask) != 0;
+}
+
 //
 // Returns the major and minor version of the loaded binary. If the version info has been fetched once, it will be cached
 // and returned without any system calls to find the version number.
@@ -39,6 +39,12 @@ public:
     DWORD GetNumberOfLogicalProcessors() const { return this->dwNumberOfProcessors; }
     DWORD GetNumberOfPhysicalProcessors() const { return this->dwNumberOfPhysicalProcessors; }
 
+    // NUMA node of the processor running the calling thread, or NUMA_NO_PREFERRED_NODE
+    // if the system has a single node (or the node can't be determined)
+    static DWORD GetCurrentNumaNode();
+    // Restrict the calling thread to the processors of a NUMA node
+    static bool SetCurrentThreadNumaAffinity(DWORD numaNode);
+
 #if SYSINFO_IMAGE_BASE_AVAILABLE
     UINT_PTR GetChakraBaseAddr() const;
 #endif
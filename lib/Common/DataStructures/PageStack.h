@@ -25,6 +25,13 @@ public:
     bool Push(T item);
 
     uint Split(uint targetCount, __in_ecount(targetCount) PageStack<T> ** targetStacks);
+    uint MoveChunks(PageStack<T> * targetStack, uint maxChunkCount);
+
+    // True if the stack holds at least one full chunk in addition to the chunk currently being pushed/popped
+    bool HasSpareChunk() const
+    {
+        return this->currentChunk != nullptr && this->currentChunk->nextChunk != nullptr;
+    }
 
     void Abort();
     void Release();
@@ -44,7 +51,7 @@ public:
     }
 #endif
 
-    static const uint MaxSplitTargets = 3;     // Not counting original stack, so this supports 4-way parallel
+    static const uint MaxSplitTargets = 63;    // Not counting original stack, so this supports 64-way parallel
 
 private:
     Chunk * CreateChunk();
@@ -353,6 +360,54 @@ uint PageStack<T>::Split(uint targetCount, __in_ecount(targetCount) PageStack<T>
 }
 
 
+template <typename T>
+uint PageStack<T>::MoveChunks(PageStack<T> * targetStack, uint maxChunkCount)
+{
+    // Move up to [maxChunkCount] full chunks from this stack to [targetStack].
+    // Only the chunks behind the current chunk are moved; these are always full, so
+    // the current chunk (and any in-progress push/pop on it) is left alone.
+    // Moved chunks are linked in behind the current chunk of the target stack,
+    // or become its current chunk if the target has none.
+    // The caller is responsible for synchronizing access to both stacks.
+
+    Assert(targetStack != nullptr && targetStack != this);
+
+    uint movedCount = 0;
+    while (movedCount < maxChunkCount && this->HasSpareChunk())
+    {
+        Chunk * chunk = this->currentChunk->nextChunk;
+        this->currentChunk->nextChunk = chunk->nextChunk;
+
+        if (targetStack->currentChunk == nullptr)
+        {
+            chunk->nextChunk = nullptr;
+            targetStack->currentChunk = chunk;
+            targetStack->chunkStart = chunk->entries;
+            targetStack->chunkEnd = &chunk->entries[EntriesPerChunk];
+            targetStack->nextEntry = targetStack->chunkEnd;
+        }
+        else
+        {
+            chunk->nextChunk = targetStack->currentChunk->nextChunk;
+            targetStack->currentChunk->nextChunk = chunk;
+        }
+
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+        this->pageCount--;
+        targetStack->pageCount++;
+#endif
+#if DBG
+        this->count -= EntriesPerChunk;
+        targetStack->count += EntriesPerChunk;
+#endif
+
+        movedCount++;
+    }
+
+    return movedCount;
+}
+
+
 template <typename T>
 void PageStack<T>::Abort()
 {
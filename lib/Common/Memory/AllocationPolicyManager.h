@@ -63,6 +63,12 @@ public:
         memoryLimit = newLimit;
     }
 
+    // No limit and no host callback to report allocations to
+    bool IsUnrestricted() const
+    {
+        return memoryLimit == (size_t)-1 && memoryAllocationCallback == NULL;
+    }
+
     bool RequestAlloc(DECLSPEC_GUARD_OVERFLOW size_t byteCount, bool externalAlloc = false)
     {
         if (supportConcurrency)
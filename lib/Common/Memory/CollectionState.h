@@ -39,6 +39,10 @@ enum CollectionState
 
     Collection_WrapperCallback      = 0x00040000,
 
+#if ENABLE_CONCURRENT_GC
+    Collection_Incremental          = 0x00080000,
+#endif
+
     // Actual states
     CollectionStateNotCollecting          = 0,                                                                // not collecting
     CollectionStateResetMarks             = Collection_Mark | Collection_ResetMarks,                          // reset marks
@@ -59,6 +63,7 @@ enum CollectionState
     CollectionStateConcurrentMark         = Collection_ConcurrentMark | Collection_ExecutingConcurrent,                            // concurrent marking
     CollectionStateRescanWait             = Collection_ConcurrentMark | Collection_FinishConcurrent,                               // rescan (after concurrent mark)
     CollectionStateConcurrentFinishMark   = Collection_ConcurrentMark | Collection_ExecutingConcurrent | Collection_FinishConcurrent,
+    CollectionStateIncrementalMark        = Collection_ConcurrentMark | Collection_Incremental,                                    // concurrent marking in slices on the main thread
 
     CollectionStateSetupConcurrentSweep   = Collection_Sweep | Collection_ConcurrentSweepSetup,               // setting up concurrent sweep
     CollectionStateConcurrentSweep        = Collection_ConcurrentSweep | Collection_ExecutingConcurrent,      // concurrent sweep
@@ -1165,7 +1165,6 @@ SmallHeapBlockT<TBlockAttributes>::SweepObjects(Recycler * recycler)
     {
         Assert(IsValidBitIndex(bitIndex));
 
-        RECYCLER_STATS_ADD(recycler, objectSweepScanCount, !isForceSweeping);
         if (!marked->Test(bitIndex))
         {
             if (!this->GetFreeBitVector()->Test(bitIndex))
@@ -1200,6 +1199,9 @@ SmallHeapBlockT<TBlockAttributes>::SweepObjects(Recycler * recycler)
     }
 
     Assert(sweepCount == expectedSweepCount);
+
+    // Blocks may be swept concurrently by the parallel sweep threads
+    RECYCLER_STATS_INTERLOCKED_ADD(recycler, objectSweepScanCount, isForceSweeping ? 0 : localObjectCount);
 #if ENABLE_CONCURRENT_GC
     this->isPendingConcurrentSweep = false;
 #endif
@@ -255,6 +255,9 @@ public:
     bool IsLargeHeapBlock() const { return this->GetHeapBlockType() == LargeBlockType; }
     char * GetAddress() const { return address; }
     Segment * GetSegment() const { return segment; }
+#if ENABLE_CONCURRENT_GC
+    bool IsPendingConcurrentSweep() const { return isPendingConcurrentSweep; }
+#endif
 
     template <typename TBlockAttributes>
     SmallNormalHeapBlockT<TBlockAttributes> * AsNormalBlock();
@@ -18,6 +18,10 @@ HeapBucket::HeapBucket() :
 #ifdef RECYCLER_PAGE_HEAP
     isPageHeapEnabled = false;
 #endif
+
+#ifdef RECYCLER_STATS
+    memset(&allocHistogram, 0, sizeof(allocHistogram));
+#endif
 }
 
 uint
@@ -757,7 +761,8 @@ HeapBucketT<TBlockType>::SweepHeapBlockList(RecyclerSweep& recyclerSweep, TBlock
 #endif
     Assert(this->IsAllocationStopped());
 
-    HeapBlockList::ForEachEditing(heapBlockList, [=, &recyclerSweep](TBlockType * heapBlock)
+    TBlockType * sparseBlockList = nullptr;
+    HeapBlockList::ForEachEditing(heapBlockList, [=, &recyclerSweep, &sparseBlockList](TBlockType * heapBlock)
     {
         // The whole list need to be consistent
         DebugOnly(VerifyBlockConsistencyInList(heapBlock, recyclerSweep));
@@ -811,8 +816,18 @@ HeapBucketT<TBlockType>::SweepHeapBlockList(RecyclerSweep& recyclerSweep, TBlock
         {
             Assert(this->nextAllocableBlockHead == nullptr);
             Assert(heapBlock->HasFreeObject());
-            heapBlock->SetNextBlock(this->heapBlockList);
-            this->heapBlockList = heapBlock;
+            if (recyclerSweep.IsSparseHeapBlock(heapBlock))
+            {
+                // Mostly empty block, keep it aside so it is appended after the denser blocks
+                heapBlock->SetNextBlock(sparseBlockList);
+                sparseBlockList = heapBlock;
+                RECYCLER_STATS_INC(recycler, numSparseSmallBlocks[heapBlock->GetHeapBlockType()]);
+            }
+            else
+            {
+                heapBlock->SetNextBlock(this->heapBlockList);
+                this->heapBlockList = heapBlock;
+            }
 #if ENABLE_PARTIAL_GC
             recyclerSweep.NotifyAllocableObjects(heapBlock);
 #endif
@@ -866,6 +881,27 @@ HeapBucketT<TBlockType>::SweepHeapBlockList(RecyclerSweep& recyclerSweep, TBlock
         }
         }
     });
+
+    this->AppendSparseHeapBlockList(sparseBlockList);
+}
+
+template <typename TBlockType>
+void
+HeapBucketT<TBlockType>::AppendSparseHeapBlockList(TBlockType * sparseBlockList)
+{
+    if (sparseBlockList != nullptr)
+    {
+        // Allocation walks the allocable list from the head, so the sparse blocks are
+        // only reused once all the denser blocks are full
+        if (this->heapBlockList == nullptr)
+        {
+            this->heapBlockList = sparseBlockList;
+        }
+        else
+        {
+            HeapBlockList::Tail(this->heapBlockList)->SetNextBlock(sparseBlockList);
+        }
+    }
 }
 
 template <typename TBlockType>
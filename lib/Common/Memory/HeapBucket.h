@@ -81,6 +81,30 @@ protected:
     size_t emptyHeapBlockCount;
 #endif
 
+#ifdef RECYCLER_STATS
+public:
+    // Histogram of the requested sizes that were rounded up to this bucket's size category
+    struct AllocHistogram
+    {
+        size_t allocCount;
+        size_t requestBytes;
+        size_t minRequestSize;
+        size_t maxRequestSize;
+    };
+
+    void RecordAllocation(size_t size)
+    {
+        allocHistogram.allocCount++;
+        allocHistogram.requestBytes += size;
+        allocHistogram.minRequestSize = (allocHistogram.allocCount == 1) ? size : min(allocHistogram.minRequestSize, size);
+        allocHistogram.maxRequestSize = max(allocHistogram.maxRequestSize, size);
+    }
+    AllocHistogram const& GetAllocHistogram() const { return allocHistogram; }
+    uint GetSizeCat() const { return sizeCat; }
+protected:
+    AllocHistogram allocHistogram;
+#endif
+
 #ifdef RECYCLER_PAGE_HEAP
     bool isPageHeapEnabled;
 public:
@@ -197,6 +221,7 @@ protected:
     bool IsAllocationStopped() const;
 #endif
     void SweepHeapBlockList(RecyclerSweep& recyclerSweep, TBlockType * heapBlockList, bool allocable);
+    void AppendSparseHeapBlockList(TBlockType * sparseBlockList);
 #if ENABLE_PARTIAL_GC
     bool DoQueuePendingSweep(Recycler * recycler);
     bool DoPartialReuseSweep(Recycler * recycler);
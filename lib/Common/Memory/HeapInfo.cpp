@@ -381,6 +381,9 @@ HeapInfo::HeapInfo() :
     , captureAllocCallStack(false)
     , captureFreeCallStack(false)
 #endif
+#ifdef RECYCLER_STATS
+    , recordAllocHistogram(false)
+#endif
 {
 }
 
@@ -467,6 +470,9 @@ HeapInfo::Initialize(Recycler * recycler
 )
 {
     this->recycler = recycler;
+#ifdef RECYCLER_STATS
+    this->recordAllocHistogram = recycler->GetRecyclerFlagsTable().DumpAllocHistogram;
+#endif
 #ifdef DUMP_FRAGMENTATION_STATS
     if (recycler->GetRecyclerFlagsTable().flags.DumpFragmentationStats)
     {
@@ -916,6 +922,7 @@ HeapInfo::Sweep(RecyclerSweep& recyclerSweep, bool concurrent)
 
 #ifdef RECYCLER_STATS
     memset(&recycler->collectionStats.numEmptySmallBlocks, 0, sizeof(recycler->collectionStats.numEmptySmallBlocks));
+    memset(&recycler->collectionStats.numSparseSmallBlocks, 0, sizeof(recycler->collectionStats.numSparseSmallBlocks));
     recycler->collectionStats.numZeroedOutSmallBlocks = 0;
 #endif
 
@@ -1073,6 +1080,85 @@ HeapInfo::DumpFragmentationStats()
 }
 #endif
 
+#ifdef RECYCLER_STATS
+struct AllocHistogramTotal
+{
+    size_t allocCount;
+    size_t requestBytes;
+    size_t allocBytes;
+};
+
+static void DumpBucketAllocHistogram(char16 const * kind, HeapBucket const& bucket, AllocHistogramTotal& total)
+{
+    HeapBucket::AllocHistogram const& histogram = bucket.GetAllocHistogram();
+    if (histogram.allocCount == 0)
+    {
+        return;
+    }
+
+    size_t allocBytes = histogram.allocCount * bucket.GetSizeCat();
+    size_t wastedBytes = allocBytes - histogram.requestBytes;
+    Output::Print(_u("%-8s %6u %12llu %8llu %8llu %15llu %15llu %15llu %6.1f\n"), kind, bucket.GetSizeCat(),
+        (unsigned long long)histogram.allocCount, (unsigned long long)histogram.minRequestSize, (unsigned long long)histogram.maxRequestSize,
+        (unsigned long long)histogram.requestBytes, (unsigned long long)allocBytes, (unsigned long long)wastedBytes,
+        (double)wastedBytes * 100 / allocBytes);
+
+    total.allocCount += histogram.allocCount;
+    total.requestBytes += histogram.requestBytes;
+    total.allocBytes += allocBytes;
+}
+
+template <class TBlockAttributes>
+static void DumpBucketGroupAllocHistogram(HeapBucketGroup<TBlockAttributes>& bucketGroup, AllocHistogramTotal& total)
+{
+    DumpBucketAllocHistogram(_u("Normal"), bucketGroup.template GetBucket<NoBit>(), total);
+    DumpBucketAllocHistogram(_u("Leaf"), bucketGroup.template GetBucket<LeafBit>(), total);
+    DumpBucketAllocHistogram(_u("Final"), bucketGroup.template GetBucket<FinalizeBit>(), total);
+#ifdef RECYCLER_WRITE_BARRIER
+    DumpBucketAllocHistogram(_u("NormalWB"), bucketGroup.template GetBucket<WithBarrierBit>(), total);
+    DumpBucketAllocHistogram(_u("FinalWB"), bucketGroup.template GetBucket<FinalizableWithBarrierBit>(), total);
+#endif
+}
+
+void
+HeapInfo::DumpAllocHistogram()
+{
+    AllocHistogramTotal total = { 0 };
+
+    Output::Print(_u("Recycler allocation histogram (small%s buckets)\n"),
+#if defined(BUCKETIZE_MEDIUM_ALLOCATIONS) && SMALLBLOCK_MEDIUM_ALLOC
+        _u(" and medium")
+#else
+        _u("")
+#endif
+        );
+#ifdef RECYCLER_GEOMETRIC_SIZE_CLASSES
+    Output::Print(_u("Size classes: geometric\n"));
+#else
+    Output::Print(_u("Size classes: fixed granularity\n"));
+#endif
+    Output::Print(_u("Bucket   SizeCat   AllocCount  MinReq   MaxReq   RequestBytes    AllocBytes      WastedBytes     Waste%%\n"));
+
+    for (uint i = 0; i < HeapConstants::BucketCount; i++)
+    {
+        DumpBucketGroupAllocHistogram(heapBuckets[i], total);
+    }
+
+#if defined(BUCKETIZE_MEDIUM_ALLOCATIONS) && SMALLBLOCK_MEDIUM_ALLOC
+    for (uint i = 0; i < HeapConstants::MediumBucketCount; i++)
+    {
+        DumpBucketGroupAllocHistogram(mediumHeapBuckets[i], total);
+    }
+#endif
+
+    size_t totalWastedBytes = total.allocBytes - total.requestBytes;
+    Output::Print(_u("Total           %12llu                   %15llu %15llu %15llu %6.1f\n"),
+        (unsigned long long)total.allocCount, (unsigned long long)total.requestBytes, (unsigned long long)total.allocBytes,
+        (unsigned long long)totalWastedBytes, total.allocBytes != 0 ? (double)totalWastedBytes * 100 / total.allocBytes : 0.0);
+    Output::Flush();
+}
+#endif
+
 #if ENABLE_PARTIAL_GC
 void
 HeapInfo::SweepPartialReusePages(RecyclerSweep& recyclerSweep)
@@ -1146,6 +1232,10 @@ HeapInfo::SweepPendingObjects(RecyclerSweep& recyclerSweep)
 {
     if (recyclerSweep.HasPendingSweepSmallHeapBlocks())
     {
+        // Sweep the objects of the pending blocks on the parallel threads first if we can,
+        // the buckets below then only need to put the swept blocks back on their lists.
+        recyclerSweep.ParallelSweepPendingObjects();
+
         for (uint i = 0; i < HeapConstants::BucketCount; i++)
         {
             heapBuckets[i].SweepPendingObjects(recyclerSweep);
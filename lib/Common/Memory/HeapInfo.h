@@ -49,6 +49,9 @@ public:
 #ifdef DUMP_FRAGMENTATION_STATS
     void DumpFragmentationStats();
 #endif
+#ifdef RECYCLER_STATS
+    void DumpAllocHistogram();
+#endif
 
     template <ObjectInfoBits attributes, bool nothrow>
     char * MediumAlloc(Recycler * recycler, size_t sizeCat, size_t size);
@@ -147,12 +150,55 @@ public:
     static BOOL IsAlignedSmallObjectSize(size_t sizeCat) { return (sizeCat != 0) && (HeapInfo::IsSmallObject(sizeCat) && (0 == (sizeCat & HeapInfo::ObjectAlignmentMask))); }
     static BOOL IsAlignedMediumObjectSize(size_t sizeCat) { return (sizeCat != 0) && (HeapInfo::IsMediumObject(sizeCat) && (0 == (sizeCat & HeapInfo::ObjectAlignmentMask))); }
 
+#ifdef RECYCLER_GEOMETRIC_SIZE_CLASSES
+    // Size classes are spaced four per power of two (16, 32, 48, 64, 80, 96, 112, 128, 160, 192, ...).
+    // Every class is still a multiple of the bucket granularity, so the bucket indexes and valid pointer
+    // maps are unchanged; the buckets in between are simply never allocated from.
+    static size_t GetGeometricSizeClass(size_t alignedSize, size_t granularity, size_t maxSize)
+    {
+        size_t step = granularity;
+        while (step * 8 < alignedSize)
+        {
+            step <<= 1;
+        }
+        return min(Math::Align<size_t>(alignedSize, step), maxSize);
+    }
+
+    static size_t GetAlignedSize(size_t size)
+    {
+        size_t alignedSize = AllocSizeMath::Align(size, HeapConstants::ObjectGranularity);
+        return alignedSize <= HeapConstants::MaxSmallObjectSize ?
+            GetGeometricSizeClass(alignedSize, HeapConstants::ObjectGranularity, HeapConstants::MaxSmallObjectSize) : alignedSize;
+    }
+    static size_t GetAlignedSizeNoCheck(size_t size)
+    {
+        size_t alignedSize = Math::Align<size_t>(size, HeapConstants::ObjectGranularity);
+        return alignedSize <= HeapConstants::MaxSmallObjectSize ?
+            GetGeometricSizeClass(alignedSize, HeapConstants::ObjectGranularity, HeapConstants::MaxSmallObjectSize) : alignedSize;
+    }
+
+#ifdef BUCKETIZE_MEDIUM_ALLOCATIONS
+    static size_t GetMediumObjectAlignedSize(size_t size)
+    {
+        size_t alignedSize = AllocSizeMath::Align(size, HeapConstants::MediumObjectGranularity);
+        return alignedSize <= HeapConstants::MaxMediumObjectSize ?
+            GetGeometricSizeClass(alignedSize, HeapConstants::MediumObjectGranularity, HeapConstants::MaxMediumObjectSize) : alignedSize;
+    }
+    static size_t GetMediumObjectAlignedSizeNoCheck(size_t size)
+    {
+        size_t alignedSize = Math::Align<size_t>(size, HeapConstants::MediumObjectGranularity);
+        return alignedSize <= HeapConstants::MaxMediumObjectSize ?
+            GetGeometricSizeClass(alignedSize, HeapConstants::MediumObjectGranularity, HeapConstants::MaxMediumObjectSize) : alignedSize;
+    }
+#endif
+#else
     static size_t GetAlignedSize(size_t size) { return AllocSizeMath::Align(size, HeapConstants::ObjectGranularity); }
     static size_t GetAlignedSizeNoCheck(size_t size) { return Math::Align<size_t>(size, HeapConstants::ObjectGranularity); }
 
 #ifdef BUCKETIZE_MEDIUM_ALLOCATIONS
     static size_t GetMediumObjectAlignedSize(size_t size) { return AllocSizeMath::Align(size, HeapConstants::MediumObjectGranularity); }
     static size_t GetMediumObjectAlignedSizeNoCheck(size_t size) { return Math::Align<size_t>(size, HeapConstants::MediumObjectGranularity); }
+#endif
 #endif
 
     static inline uint GetBucketIndex(size_t sizeCat) { Assert(IsAlignedSmallObjectSize(sizeCat)); return (uint)(sizeCat >> HeapConstants::ObjectAllocationShift) - 1; }
@@ -427,6 +473,10 @@ private:
 #endif
     LargeHeapBucket largeObjectBucket;
 
+#ifdef RECYCLER_STATS
+    bool recordAllocHistogram;
+#endif
+
     static const size_t ObjectAlignmentMask = HeapConstants::ObjectGranularity - 1;         // 0xF
 #ifdef RECYCLER_SLOW_CHECK_ENABLED
     size_t heapBlockCount[HeapBlock::BlockTypeCount];
@@ -496,6 +546,12 @@ HeapInfo::RealAlloc(Recycler * recycler, size_t sizeCat, size_t size)
 {
     Assert(HeapInfo::IsAlignedSmallObjectSize(sizeCat));
     auto& bucket = this->GetBucket<(ObjectInfoBits)(attributes & GetBlockTypeBitMask)>(sizeCat);
+#ifdef RECYCLER_STATS
+    if (this->recordAllocHistogram)
+    {
+        bucket.RecordAllocation(size);
+    }
+#endif
     return bucket.template RealAlloc<attributes, nothrow>(recycler, sizeCat, size);
 }
 
@@ -506,6 +562,12 @@ inline char *
 HeapInfo::MediumAlloc(Recycler * recycler, size_t sizeCat, size_t size)
 {
     auto& bucket = this->GetMediumBucket<(ObjectInfoBits)(attributes & GetBlockTypeBitMask)>(sizeCat);
+#ifdef RECYCLER_STATS
+    if (this->recordAllocHistogram)
+    {
+        bucket.RecordAllocation(size);
+    }
+#endif
 
     return bucket.template RealAlloc<attributes, nothrow>(recycler, sizeCat, size);
 }
@@ -100,5 +100,98 @@ void MarkContext::ProcessTracked()
     trackStack.Release();
 }
 
+#if ENABLE_CONCURRENT_GC
+ParallelMarkWorkQueue::ParallelMarkWorkQueue(Js::ConfigFlagsTable& flagsTable) :
+    pagePool(flagsTable),
+    markStack(&pagePool),
+    activeCount(0),
+    waitingCount(0),
+    hasWork(false)
+{
+}
+
+void ParallelMarkWorkQueue::Init()
+{
+    // Preallocate the current chunk, so that donated chunks are always linked in behind it
+    // and can be moved out again with PageStack::MoveChunks.
+    markStack.Init();
+}
+
+void ParallelMarkWorkQueue::Release()
+{
+    Assert(IsEmpty());
+    markStack.Release();
+    pagePool.ReleaseFreePages();
+}
+
+void ParallelMarkWorkQueue::Enter()
+{
+    ::InterlockedIncrement(&this->activeCount);
+}
+
+void ParallelMarkWorkQueue::Donate(MarkContext * markContext)
+{
+    AutoCriticalSection autocs(&this->cs);
 
+    // Give one chunk to each waiting context, as far as our spare chunks go.
+    uint donateCount = (uint)this->waitingCount;
+    if (donateCount == 0)
+    {
+        return;
+    }
+
+    uint movedCount = markContext->markStack.MoveChunks(&this->markStack, donateCount);
+    if (movedCount != 0)
+    {
+        this->hasWork = true;
+    }
+}
 
+bool ParallelMarkWorkQueue::Steal(MarkContext * markContext)
+{
+    // The context's own mark stack is empty. Stop being active and wait for either
+    // a donated chunk or for every other context to run dry too.
+    Assert(markContext->markStack.IsEmpty());
+
+    ::InterlockedIncrement(&this->waitingCount);
+    ::InterlockedDecrement(&this->activeCount);
+
+    uint spinCount = 0;
+    while (true)
+    {
+        if (this->hasWork || this->activeCount == 0)
+        {
+            AutoCriticalSection autocs(&this->cs);
+
+            if (this->markStack.HasSpareChunk())
+            {
+                uint movedCount = this->markStack.MoveChunks(&markContext->markStack, 1);
+                Assert(movedCount == 1);
+                this->hasWork = this->markStack.HasSpareChunk();
+
+                // Become active again while holding the lock, so that no other waiting
+                // context can see an empty queue with no active contexts and finish early.
+                ::InterlockedIncrement(&this->activeCount);
+                ::InterlockedDecrement(&this->waitingCount);
+                return true;
+            }
+
+            if (this->activeCount == 0)
+            {
+                // Nobody can donate any more work. We're done.
+                ::InterlockedDecrement(&this->waitingCount);
+                return false;
+            }
+        }
+
+        if (++spinCount < 64)
+        {
+            YieldProcessor();
+        }
+        else
+        {
+            SwitchToThread();
+        }
+    }
+}
+#endif
@@ -5,11 +5,16 @@
 namespace Memory
 {
 class Recycler;
+class ParallelMarkWorkQueue;
 
 typedef JsUtil::SynchronizedDictionary<void *, void *, NoCheckHeapAllocator, PrimeSizePolicy, RecyclerPointerComparer, JsUtil::SimpleDictionaryEntry, Js::DefaultContainerLockPolicy, CriticalSection> MarkMap;
 
 class MarkContext
 {
+#if ENABLE_CONCURRENT_GC
+    friend class ParallelMarkWorkQueue;
+#endif
+
 private:
     struct MarkCandidate
     {
@@ -43,6 +48,10 @@ public:
     void ScanMemory(void ** obj, size_t byteCount);
     template <bool parallel, bool interior>
     void ProcessMark();
+#if ENABLE_CONCURRENT_GC
+    template <bool interior>
+    bool ProcessMarkSlice(LONGLONG deadline);
+#endif
 
     void MarkTrackedObject(FinalizableObject * obj);
     void ProcessTracked();
@@ -109,7 +118,49 @@ private:
 
     void OnObjectMarked(void* object, void* parent);
 #endif
+
+    // Number of objects scanned between checks for parallel contexts waiting for work
+    static const uint DonateCheckInterval = 256;
+
+    // Number of objects scanned between checks of the incremental mark slice deadline
+    static const uint SliceCheckInterval = 256;
+
+    template <bool parallel, bool interior>
+    void ProcessMarkStack(ParallelMarkWorkQueue * workQueue);
 };
 
+#if ENABLE_CONCURRENT_GC
+// Balances work between the mark contexts during a parallel mark.
+// Each parallel mark context processes its own mark stack. A context that runs dry
+// waits on the queue; contexts that still have spare (full) mark stack chunks donate
+// them to the queue when they see a waiting context, and the waiting context steals them.
+// Marking is complete when no context is active and the queue is empty.
+class ParallelMarkWorkQueue
+{
+public:
+    ParallelMarkWorkQueue(Js::ConfigFlagsTable& flagsTable);
+
+    void Init();
+    void Release();
+
+    void Enter();
+    bool HasWaitingContext() const { return this->waitingCount != 0; }
+    void Donate(MarkContext * markContext);
+    bool Steal(MarkContext * markContext);
+
+#if DBG
+    bool IsEmpty() const { return this->activeCount == 0 && this->waitingCount == 0 && this->markStack.IsEmpty(); }
+#endif
+
+private:
+    CriticalSection cs;
+    PagePool pagePool;
+    PageStack<MarkContext::MarkCandidate> markStack;
+    LONG volatile activeCount;      // # of contexts currently processing their own mark stack
+    LONG volatile waitingCount;     // # of contexts waiting for work in Steal
+    bool volatile hasWork;          // the queue's mark stack has chunks; read without the lock
+};
+#endif
+
 
 }
@@ -174,6 +174,79 @@ void MarkContext::ProcessMark()
     }
 #endif
 
+#if ENABLE_CONCURRENT_GC
+    if (parallel && recycler->enableParallelMarkWorkStealing)
+    {
+        // Share work with the other parallel mark contexts until all of them run dry.
+        ParallelMarkWorkQueue * workQueue = &recycler->parallelMarkWorkQueue;
+        workQueue->Enter();
+        do
+        {
+            ProcessMarkStack<parallel, interior>(workQueue);
+        }
+        while (workQueue->Steal(this));
+    }
+    else
+#endif
+    {
+        ProcessMarkStack<parallel, interior>(nullptr);
+    }
+
+    Assert(markStack.IsEmpty());
+}
+
+#if ENABLE_CONCURRENT_GC
+// Process the mark stack on the main thread until it is empty or the performance counter passes
+// the deadline. Returns true if the mark stack has been drained.
+template <bool interior>
+inline
+bool MarkContext::ProcessMarkSlice(LONGLONG deadline)
+{
+    uint sliceCheckCountdown = SliceCheckInterval;
+    MarkCandidate current;
+
+    while (markStack.Pop(&current))
+    {
+        ScanObject<false, interior>(current.obj, current.byteCount);
+
+        if (--sliceCheckCountdown == 0)
+        {
+            sliceCheckCountdown = SliceCheckInterval;
+
+            LARGE_INTEGER now;
+            QueryPerformanceCounter(&now);
+            if (now.QuadPart >= deadline)
+            {
+                return markStack.IsEmpty();
+            }
+        }
+    }
+
+    return true;
+}
+#endif
+
+template <bool parallel, bool interior>
+inline
+void MarkContext::ProcessMarkStack(ParallelMarkWorkQueue * workQueue)
+{
+#if ENABLE_CONCURRENT_GC
+    // Only check for waiting contexts every so often, to keep the common path cheap.
+    uint donateCheckCountdown = DonateCheckInterval;
+#define MARK_CONTEXT_CHECK_DONATE() \
+    if (parallel && workQueue != nullptr && --donateCheckCountdown == 0) \
+    { \
+        donateCheckCountdown = DonateCheckInterval; \
+        if (workQueue->HasWaitingContext() && markStack.HasSpareChunk()) \
+        { \
+            workQueue->Donate(this); \
+        } \
+    }
+#else
+    Assert(workQueue == nullptr);
+#define MARK_CONTEXT_CHECK_DONATE()
+#endif
+
 #if defined(_M_IX86) || defined(_M_X64)
     MarkCandidate current, next;
 
@@ -189,6 +262,8 @@ void MarkContext::ProcessMark()
             ScanObject<parallel, interior>(current.obj, current.byteCount);
 
             current = next;
+
+            MARK_CONTEXT_CHECK_DONATE();
         }
 
         // The stack is empty, but we still have a previously retrieved entry; process it now.
@@ -205,9 +280,10 @@ void MarkContext::ProcessMark()
     while (markStack.Pop(&current))
     {
         ScanObject<parallel, interior>(current.obj, current.byteCount);
+
+        MARK_CONTEXT_CHECK_DONATE();
     }
 #endif
 
-    Assert(markStack.IsEmpty());
+#undef MARK_CONTEXT_CHECK_DONATE
 }
-
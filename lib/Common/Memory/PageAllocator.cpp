@@ -103,7 +103,7 @@ SegmentBase<T>::Initialize(DWORD allocFlags, bool excludeGuardPages)
         return false;
     }
 
-    this->address = (char *)GetAllocator()->GetVirtualAllocator()->Alloc(NULL, totalPages * AutoSystemInfo::PageSize, MEM_RESERVE | allocFlags, PAGE_READWRITE, this->IsInCustomHeapAllocator(), this->GetAllocator()->processHandle);
+    this->address = (char *)GetAllocator()->GetVirtualAllocator()->Alloc(NULL, totalPages * AutoSystemInfo::PageSize, MEM_RESERVE | allocFlags, PAGE_READWRITE, this->IsInCustomHeapAllocator(), this->GetAllocator()->processHandle, this->GetAllocator()->numaNode);
 
     if (this->address == nullptr)
     {
@@ -623,6 +623,10 @@ PageAllocatorBase<T>::PageAllocatorBase(AllocationPolicyManager * policyManager,
     disableAllocationOutOfMemory(false),
     secondaryAllocPageCount(secondaryAllocPageCount),
     excludeGuardPages(excludeGuardPages),
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    hugePageSegments(false),
+#endif
+    numaNode(NUMA_NO_PREFERRED_NODE),
     type(type)
     , reservedBytes(0)
     , committedBytes(0)
@@ -1111,7 +1115,8 @@ PageAllocatorBase<T>::AllocSegment(size_t pageCount)
     {
         return nullptr;
     }
-    if (!segment->Initialize(MEM_COMMIT | allocFlags, excludeGuardPages))
+    // Large segments are sized by the request, so they never get the huge page alignment of the page segments
+    if (!segment->Initialize(MEM_COMMIT | (allocFlags & ~MEM_LARGE_PAGES), excludeGuardPages))
     {
         largeSegments.RemoveHead(&NoThrowNoMemProtectHeapAllocator::Instance);
         return nullptr;
@@ -1371,7 +1376,7 @@ PageAllocatorBase<T>::SnailAllocPages(uint pageCount, PageSegmentBase<T> ** page
 
     Assert(pages == nullptr);
     Assert(maxAllocPageCount >= pageCount);
-    if (maxAllocPageCount != pageCount && (maxFreePageCount < maxAllocPageCount - pageCount + freePageCount))
+    if (maxAllocPageCount != pageCount && (maxFreePageCount < maxAllocPageCount - pageCount + freePageCount) && !this->IsHugePageSegments())
     {
         // If we exceed the number of max free page count, allocate from a new fully decommit block
         PageSegmentBase<T> * decommitSegment = AllocPageSegment(this->decommitSegments, this, false, false);
@@ -1565,6 +1570,15 @@ PageAllocatorBase<T>::ReleasePages(__in void * address, uint pageCount, __in voi
             this->AddFreePageCount(pageCount);
 
         }
+        else if (this->IsHugePageSegments())
+        {
+            // Decommitting part of the segment would split its huge page. Keep the pages
+            // free instead; DecommitNow releases the segment once it is entirely empty.
+            this->FillFreePages((char *)address, pageCount);
+            segment->ReleasePages(address, pageCount);
+            LogFreePages(pageCount);
+            this->AddFreePageCount(pageCount);
+        }
         else
         {
             segment->template DecommitPages<false>(address, pageCount);
@@ -1908,6 +1922,9 @@ PageAllocatorBase<T>::DecommitNow(bool all)
     size_t decommitCount = 0;
 #endif
 
+    // Huge page segments are never partially decommitted
+    Assert(!this->IsHugePageSegments() || decommitSegments.Empty());
+
     // decommit from page that already has other decommitted page already
     {
         typename DListBase<PageSegmentBase<T>>::EditingIterator i(&decommitSegments);
@@ -1935,12 +1952,19 @@ PageAllocatorBase<T>::DecommitNow(bool all)
 
     while (pageToDecommit > 0 && !emptySegments.Empty())
     {
-        if (pageToDecommit >= maxAllocPageCount)
+        if (pageToDecommit >= maxAllocPageCount || this->IsHugePageSegments())
         {
             Assert(emptySegments.Head().GetDecommitPageCount() == 0);
             LogFreeSegment(&emptySegments.Head());
             emptySegments.RemoveHead(&NoThrowNoMemProtectHeapAllocator::Instance);
 
+            if (pageToDecommit < maxAllocPageCount)
+            {
+                // A huge page segment can only be released whole, which frees more pages than we asked for
+                newFreePageCount -= maxAllocPageCount - pageToDecommit;
+                pageToDecommit = maxAllocPageCount;
+            }
+
             pageToDecommit -= maxAllocPageCount;
 #if DBG_DUMP
             decommitCount += maxAllocPageCount;
@@ -1960,6 +1984,13 @@ PageAllocatorBase<T>::DecommitNow(bool all)
         }
     }
 
+    if (this->IsHugePageSegments())
+    {
+        // Keep the free pages of partially used huge page segments committed
+        newFreePageCount += pageToDecommit;
+        pageToDecommit = 0;
+    }
+
     {
         typename DListBase<PageSegmentBase<T>>::EditingIterator i(&segments);
 
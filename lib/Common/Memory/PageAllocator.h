@@ -230,9 +230,13 @@ public:
     PageSegmentBase(PageAllocatorBase<TVirtualAlloc> * allocator, bool committed, bool allocated);
     PageSegmentBase(PageAllocatorBase<TVirtualAlloc> * allocator, void* address, uint pageCount, uint committedCount);
     // Maximum possible size of a PageSegment; may be smaller.
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    static const uint MaxDataPageCount = 512;     // 2 MB (one huge page)
+#else
     static const uint MaxDataPageCount = 256;     // 1 MB
+#endif
     static const uint MaxGuardPageCount = 16;
-    static const uint MaxPageCount = MaxDataPageCount + MaxGuardPageCount;  // 272 Pages
+    static const uint MaxPageCount = MaxDataPageCount + MaxGuardPageCount;  // 272 (or 528) Pages
 
     typedef BVStatic<MaxPageCount> PageBitVector;
 
@@ -473,6 +477,9 @@ public:
 
     static uint const DefaultMaxAllocPageCount = 32;        // 128K
     static uint const DefaultSecondaryAllocPageCount = 0;
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    static uint const HugePageSegmentPageCount = 512;       // 2 MB
+#endif
 
     static size_t GetProcessUsedBytes();
 
@@ -524,6 +531,10 @@ public:
 
     AllocationPolicyManager * GetAllocationPolicyManager() { return policyManager; }
 
+    // Segments reserved from now on prefer memory from this NUMA node
+    void SetNumaNode(DWORD numaNode) { this->numaNode = numaNode; }
+    DWORD GetNumaNode() const { return numaNode; }
+
     uint GetMaxAllocPageCount();
 
     //VirtualAllocator APIs
@@ -551,6 +562,7 @@ public:
     void DecommitNow(bool all = true);
     void SuspendIdleDecommit();
     void ResumeIdleDecommit();
+    size_t GetFreePageCount() const { return freePageCount; }
 
 #if ENABLE_BACKGROUND_PAGE_ZEROING
     void StartQueueZeroPage();
@@ -652,6 +664,12 @@ protected:
 #endif
 
     bool ZeroPages() const { return zeroPages; }
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    // Each page segment is a single huge page; never decommit part of one.
+    bool IsHugePageSegments() const { return hugePageSegments; }
+#else
+    bool IsHugePageSegments() const { return false; }
+#endif
 #if ENABLE_BACKGROUND_PAGE_ZEROING
     bool QueueZeroPages() const { return queueZeroPages; }
 #endif
@@ -680,6 +698,10 @@ protected:
     bool stopAllocationOnOutOfMemory;
     bool disableAllocationOutOfMemory;
     bool excludeGuardPages;
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    bool hugePageSegments;
+#endif
+    DWORD numaNode;
     AllocationPolicyManager * policyManager;
 
 #ifndef JD_PRIVATE
@@ -131,14 +131,10 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     recyclerWithBarrierPageAllocator(this, policyManager, configFlagsTable, RecyclerHeuristic::Instance.DefaultMaxFreePageCount),
 #endif
     threadPageAllocator(pageAllocator),
+    numaNode(NUMA_NO_PREFERRED_NODE),
     markPagePool(configFlagsTable),
-    parallelMarkPagePool1(configFlagsTable),
-    parallelMarkPagePool2(configFlagsTable),
-    parallelMarkPagePool3(configFlagsTable),
     markContext(this, &this->markPagePool),
-    parallelMarkContext1(this, &this->parallelMarkPagePool1),
-    parallelMarkContext2(this, &this->parallelMarkPagePool2),
-    parallelMarkContext3(this, &this->parallelMarkPagePool3),
+    parallelMarkContextCount(0),
 #if ENABLE_PARTIAL_GC
     clientTrackedObjectAllocator(_u("CTO-List"), GetPageAllocator(), Js::Throw::OutOfMemory),
 #endif
@@ -162,12 +158,15 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     queueTrackedObject(false),
     enableConcurrentMark(false),  // Default to non-concurrent
     enableParallelMark(false),
+    enableParallelMarkWorkStealing(false),
+    enableParallelSweep(false),
+    parallelMarkWorkQueue(configFlagsTable),
+    incrementalMarkBudget((uint)max(0, (int)configFlagsTable.RecyclerIncrementalMarkBudget)),
     enableConcurrentSweep(false),
     concurrentThread(NULL),
     concurrentWorkReadyEvent(NULL),
     concurrentWorkDoneEvent(NULL),
-    parallelThread1(this, &Recycler::ParallelWorkFunc<0>),
-    parallelThread2(this, &Recycler::ParallelWorkFunc<1>),
+    parallelThreadCount(0),
     priorityBoost(false),
     isAborting(false),
 #if DBG
@@ -259,9 +258,6 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
 #ifdef RECYCLER_MARK_TRACK
     this->markMap = NoCheckHeapNew(MarkMap, &NoCheckHeapAllocator::Instance, 163, &markMapCriticalSection);
     markContext.SetMarkMap(markMap);
-    parallelMarkContext1.SetMarkMap(markMap);
-    parallelMarkContext2.SetMarkMap(markMap);
-    parallelMarkContext3.SetMarkMap(markMap);
 #endif
 
 #ifdef RECYCLER_MEMORY_VERIFY
@@ -330,9 +326,6 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     // recycler requires at least Recycler::PrimaryMarkStackReservedPageCount to function properly for the main mark context
     this->markContext.SetMaxPageCount(max(static_cast<size_t>(GetRecyclerFlagsTable().MaxMarkStackPageCount), static_cast<size_t>(Recycler::PrimaryMarkStackReservedPageCount)));
-    this->parallelMarkContext1.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
-    this->parallelMarkContext2.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
-    this->parallelMarkContext3.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
 
     if (GetRecyclerFlagsTable().IsEnabled(Js::GCMemoryThresholdFlag))
     {
@@ -478,6 +471,13 @@ Recycler::~Recycler()
     }
 #endif
 
+#ifdef RECYCLER_STATS
+    if (GetRecyclerFlagsTable().DumpAllocHistogram)
+    {
+        autoHeap.DumpAllocHistogram();
+    }
+#endif
+
     AUTO_LEAK_REPORT_SECTION(this->GetRecyclerFlagsTable(), _u("Recycler (%p): %s"), this, this->IsInDllCanUnloadNow()? _u("DllCanUnloadNow") :
         this->IsInDetachProcess()? _u("DetachProcess") : _u("Destructor"));
 #ifdef LEAK_REPORT
@@ -514,9 +514,21 @@ Recycler::~Recycler()
 #endif
 
     markContext.Release();
-    parallelMarkContext1.Release();
-    parallelMarkContext2.Release();
-    parallelMarkContext3.Release();
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        this->parallelMarkContexts[i]->markContext.Release();
+        HeapDelete(this->parallelMarkContexts[i]);
+    }
+    this->parallelMarkContextCount = 0;
+
+#if ENABLE_CONCURRENT_GC
+    for (uint i = 0; i < this->parallelThreadCount; i++)
+    {
+        HeapDelete(this->parallelThreads[i]);
+    }
+    this->parallelThreadCount = 0;
+    this->parallelMarkWorkQueue.Release();
+#endif
 
     // Clean up the weak reference map so that
     // objects being finalized can safely refer to weak references
@@ -747,6 +759,18 @@ Recycler::Initialize(const bool forceInThread, JsUtil::ThreadService *threadServ
     collectionParam.domCollect = false;
 #endif
 
+#if ENABLE_HUGE_PAGE_SEGMENTS
+    if (GetRecyclerFlagsTable().RecyclerHugePageSegments)
+    {
+        // Small and medium heap blocks come out of 2MB segments backed by huge pages,
+        // which cuts the TLB misses of marking and sweeping a large heap.
+        recyclerPageAllocator.EnableHugePageSegments();
+#ifdef RECYCLER_WRITE_BARRIER_ALLOC_SEPARATE_PAGE
+        recyclerWithBarrierPageAllocator.EnableHugePageSegments();
+#endif
+    }
+#endif
+
 #if defined(PROFILE_RECYCLER_ALLOC) || defined(RECYCLER_MEMORY_VERIFY) || defined(MEMSPECT_TRACKING) || defined(ETW_MEMORY_TRACKING)
     bool dontNeedDetailedTracking = false;
 
@@ -831,7 +855,13 @@ Recycler::Initialize(const bool forceInThread, JsUtil::ThreadService *threadServ
 #if ENABLE_CONCURRENT_GC
     // Default to non-concurrent
     uint numProcs = (uint)AutoSystemInfo::Data.GetNumberOfPhysicalProcessors();
-    this->maxParallelism = (numProcs > 4) || CUSTOM_PHASE_FORCE1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase) ? 4 : numProcs;
+    uint parallelismCap = (uint)max(2, min((int)Recycler::MaxParallelism, (int)GetRecyclerFlagsTable().RecyclerMaxParallelism));
+    this->maxParallelism = (numProcs > parallelismCap) || CUSTOM_PHASE_FORCE1(GetRecyclerFlagsTable(), Js::ParallelMarkPhase) ? parallelismCap : numProcs;
+
+    if (!forceInThread && this->maxParallelism > 1)
+    {
+        this->InitializeParallelMark();
+    }
 
     if (forceInThread)
     {
@@ -920,6 +950,22 @@ Recycler::Prime()
     ForRecyclerPageAllocator(Prime(RecyclerPageAllocator::DefaultPrimePageCount));
 }
 
+void
+Recycler::SetNumaNode(DWORD numaNode)
+{
+    // The pages reserved from here on, including the mark stacks, come from this node,
+    // and the concurrent and parallel GC threads pin themselves to it when they start.
+    // Call it before Initialize so that nothing has been reserved or started yet.
+    Assert(this->collectionState == CollectionStateNotCollecting);
+#if ENABLE_CONCURRENT_GC
+    Assert(this->concurrentThread == NULL && this->parallelThreadCount == 0);
+#endif
+
+    this->numaNode = numaNode;
+    ForRecyclerPageAllocator(SetNumaNode(numaNode));
+    this->markPagePool.GetPageAllocator()->SetNumaNode(numaNode);
+}
+
 void
 Recycler::AddExternalMemoryUsage(size_t size)
 {
@@ -2137,9 +2183,11 @@ Recycler::ResetMarkCollectionState()
 
     // If we aborted after doing a background parallel Mark, we wouldn't have cleaned up the
     // parallel markContexts yet. Clean these up now.
-    // Note parallelMarkContext1 is not used in background parallel (see DoBackgroundParallelMark)
-    parallelMarkContext2.Cleanup();
-    parallelMarkContext3.Cleanup();
+    // Note parallelMarkContexts[0] is not used in background parallel (see DoBackgroundParallelMark)
+    for (uint i = 1; i < this->parallelMarkContextCount; i++)
+    {
+        GetParallelMarkContext(i)->Cleanup();
+    }
 
     this->ClearNeedOOMRescan();
     DebugOnly(this->isProcessingRescan = false);
@@ -2297,14 +2345,18 @@ void
 Recycler::DoParallelMark()
 {
     Assert(this->enableParallelMark);
-    Assert(this->maxParallelism > 1 && this->maxParallelism <= 4);
+    Assert(this->maxParallelism > 1 && this->maxParallelism <= this->parallelMarkContextCount + 1);
 
     // Split the mark stack into [this->maxParallelism] equal pieces.
     // The actual # of splits is returned, in case the stack was too small to split that many ways.
-    MarkContext * splitContexts[3] = { &parallelMarkContext1, &parallelMarkContext2, &parallelMarkContext3 };
+    MarkContext * splitContexts[Recycler::MaxParallelism - 1];
+    for (uint i = 0; i < this->maxParallelism - 1; i++)
+    {
+        splitContexts[i] = GetParallelMarkContext(i);
+    }
     uint actualSplitCount = markContext.Split(this->maxParallelism - 1, splitContexts);
 
-    Assert(actualSplitCount <= 3);
+    Assert(actualSplitCount <= this->maxParallelism - 1);
 
     // If we failed to split at all, just mark in thread with no parallelism.
     if (actualSplitCount == 0)
@@ -2326,20 +2378,16 @@ Recycler::DoParallelMark()
     bool concurrentSuccess = StartConcurrent(CollectionStateParallelMark);
 
     // If there's enough work to split, then kick off marking on parallel threads too.
-    // If the threads haven't been created yet, this will create them (or fail).
-    bool parallelSuccess1 = false;
-    bool parallelSuccess2 = false;
-    if (concurrentSuccess && actualSplitCount >= 2)
+    // The main thread takes parallelMarkContexts[0], so there are (actualSplitCount - 1) splits left for them.
+    uint parallelWorkCount = actualSplitCount - 1;
+    uint startedThreadCount = 0;
+    if (concurrentSuccess)
     {
-        parallelSuccess1 = parallelThread1.StartConcurrent();
-        if (parallelSuccess1 && actualSplitCount == 3)
-        {
-            parallelSuccess2 = parallelThread2.StartConcurrent();
-        }
+        startedThreadCount = this->StartParallelThreads(parallelWorkCount);
     }
 
     // Process our portion of the split.
-    this->ProcessParallelMark(false, &parallelMarkContext1);
+    this->ProcessParallelMark(false, GetParallelMarkContext(0));
 
     // If we successfully launched parallel work, wait for it to complete.
     // If we failed, then process the work in-thread now.
@@ -2352,29 +2400,7 @@ Recycler::DoParallelMark()
         this->ProcessParallelMark(false, &markContext);
     }
 
-    if (actualSplitCount >= 2)
-    {
-        if (parallelSuccess1)
-        {
-            parallelThread1.WaitForConcurrent();
-        }
-        else
-        {
-            this->ProcessParallelMark(false, &parallelMarkContext2);
-        }
-
-        if (actualSplitCount == 3)
-        {
-            if (parallelSuccess2)
-            {
-                parallelThread2.WaitForConcurrent();
-            }
-            else
-            {
-                this->ProcessParallelMark(false, &parallelMarkContext3);
-            }
-        }
-    }
+    this->WaitForParallelMarkThreads(false, startedThreadCount, parallelWorkCount);
 
     this->collectionState = CollectionStateMark;
 
@@ -2401,19 +2427,23 @@ Recycler::DoBackgroundParallelMark()
 {
     // Split the mark stack into [this->maxParallelism - 1] equal pieces (thus, "- 2" below).
     // The actual # of splits is returned, in case the stack was too small to split that many ways.
-    // The parallel threads are hardwired to use parallelMarkContext2/3, so we split using those.
+    // Parallel thread i is hardwired to use parallelMarkContexts[i + 1], so we split using those.
     uint actualSplitCount = 0;
-    MarkContext * splitContexts[2] = { &parallelMarkContext2, &parallelMarkContext3 };
+    MarkContext * splitContexts[Recycler::MaxParallelism - 2];
     if (this->enableParallelMark)
     {
-        Assert(this->maxParallelism > 1 && this->maxParallelism <= 4);
+        Assert(this->maxParallelism > 1 && this->maxParallelism <= this->parallelMarkContextCount + 1);
         if (this->maxParallelism > 2)
         {
+            for (uint i = 1; i < this->maxParallelism - 1; i++)
+            {
+                splitContexts[i - 1] = GetParallelMarkContext(i);
+            }
             actualSplitCount = markContext.Split(this->maxParallelism - 2, splitContexts);
         }
     }
 
-    Assert(actualSplitCount <= 2);
+    Assert(actualSplitCount + 2 <= this->maxParallelism);
 
     // If we failed to split at all, just mark in thread with no parallelism.
     if (actualSplitCount == 0)
@@ -2433,41 +2463,94 @@ Recycler::DoBackgroundParallelMark()
 
     // Kick off marking on parallel threads too, if there is work for them
     // If the threads haven't been created yet, this will create them (or fail).
-    bool parallelSuccess1 = false;
-    bool parallelSuccess2 = false;
-    parallelSuccess1 = parallelThread1.StartConcurrent();
-    if (parallelSuccess1 && actualSplitCount == 2)
-    {
-        parallelSuccess2 = parallelThread2.StartConcurrent();
-    }
+    uint startedThreadCount = this->StartParallelThreads(actualSplitCount);
 
     // Process our portion of the split.
     this->ProcessParallelMark(true, &markContext);
 
     // If we successfully launched parallel work, wait for it to complete.
     // If we failed, then process the work in-thread now.
-    if (parallelSuccess1)
+    this->WaitForParallelMarkThreads(true, startedThreadCount, actualSplitCount);
+
+    this->collectionState = CollectionStateConcurrentMark;
+}
+
+uint
+Recycler::StartParallelThreads(uint threadCount)
+{
+    Assert(threadCount <= this->parallelThreadCount);
+
+    // Start the threads in order and stop at the first failure;
+    // the caller is responsible for the work of the threads that didn't start.
+    uint startedThreadCount = 0;
+    while (startedThreadCount < threadCount && this->parallelThreads[startedThreadCount]->StartConcurrent())
     {
-        parallelThread1.WaitForConcurrent();
+        startedThreadCount++;
     }
-    else
+    return startedThreadCount;
+}
+
+void
+Recycler::WaitForParallelThreads(uint startedThreadCount)
+{
+    Assert(startedThreadCount <= this->parallelThreadCount);
+
+    for (uint i = 0; i < startedThreadCount; i++)
     {
-        this->ProcessParallelMark(true, &parallelMarkContext2);
+        this->parallelThreads[i]->WaitForConcurrent();
     }
+}
+
+void
+Recycler::WaitForParallelMarkThreads(bool background, uint startedThreadCount, uint threadCount)
+{
+    Assert(startedThreadCount <= threadCount);
+
+    this->WaitForParallelThreads(startedThreadCount);
 
-    if (actualSplitCount == 2)
+    for (uint i = startedThreadCount; i < threadCount; i++)
     {
-        if (parallelSuccess2)
-        {
-            parallelThread2.WaitForConcurrent();
-        }
-        else
-        {
-            this->ProcessParallelMark(true, &parallelMarkContext3);
-        }
+        this->ProcessParallelMark(background, GetParallelMarkContext(i + 1));
     }
+}
 
-    this->collectionState = CollectionStateConcurrentMark;
+void
+Recycler::InitializeParallelMark()
+{
+    Assert(this->parallelMarkContextCount == 0 && this->parallelThreadCount == 0);
+    Assert(this->maxParallelism > 1 && this->maxParallelism <= Recycler::MaxParallelism);
+
+    this->parallelMarkWorkQueue.Init();
+
+    for (uint i = 0; i < this->maxParallelism - 1; i++)
+    {
+        ParallelMarkContext * parallelMarkContext = HeapNew(ParallelMarkContext, this, GetRecyclerFlagsTable());
+        parallelMarkContext->pagePool.GetPageAllocator()->SetNumaNode(this->numaNode);
+#ifdef RECYCLER_MARK_TRACK
+        parallelMarkContext->markContext.SetMarkMap(markMap);
+#endif
+#ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+        parallelMarkContext->markContext.SetMaxPageCount(GetRecyclerFlagsTable().MaxMarkStackPageCount);
+#endif
+        this->parallelMarkContexts[i] = parallelMarkContext;
+        this->parallelMarkContextCount++;
+    }
+
+    for (uint i = 0; i + 2 < this->maxParallelism; i++)
+    {
+        this->parallelThreads[i] = HeapNew(RecyclerParallelThread, this, &Recycler::ParallelWorkFunc, i);
+        this->parallelThreadCount++;
+    }
+}
+
+void
+Recycler::ShutdownParallelThreads(uint threadCount)
+{
+    Assert(threadCount <= this->parallelThreadCount);
+    for (uint i = 0; i < threadCount; i++)
+    {
+        this->parallelThreads[i]->Shutdown();
+    }
 }
 #endif
 
@@ -2585,15 +2668,11 @@ Recycler::EndMark()
     // Clean up mark contexts, which will release held free pages
     // Do this for all contexts before we decommit, to make sure all pages are freed
     markContext.Cleanup();
-    parallelMarkContext1.Cleanup();
-    parallelMarkContext2.Cleanup();
-    parallelMarkContext3.Cleanup();
+    ForEachParallelMarkContext([](MarkContext * context) { context->Cleanup(); });
 
     // Decommit all pages
     markContext.DecommitPages();
-    parallelMarkContext1.DecommitPages();
-    parallelMarkContext2.DecommitPages();
-    parallelMarkContext3.DecommitPages();
+    ForEachParallelMarkContext([](MarkContext * context) { context->DecommitPages(); });
 
     GCETW(GC_DECOMMIT_CONCURRENT_COLLECT_PAGE_ALLOCATOR_STOP, (this));
 
@@ -2680,9 +2759,7 @@ Recycler::EndMarkOnLowMemory()
     while (this->NeedOOMRescan());
 
     Assert(!markContext.GetPageAllocator()->DisableAllocationOutOfMemory());
-    Assert(!parallelMarkContext1.GetPageAllocator()->DisableAllocationOutOfMemory());
-    Assert(!parallelMarkContext2.GetPageAllocator()->DisableAllocationOutOfMemory());
-    Assert(!parallelMarkContext3.GetPageAllocator()->DisableAllocationOutOfMemory());
+    ForEachParallelMarkContext([](MarkContext * context) { Assert(!context->GetPageAllocator()->DisableAllocationOutOfMemory()); });
     CUSTOM_PHASE_PRINT_TRACE1(GetRecyclerFlagsTable(), Js::RecyclerPhase, _u("EndMarkOnLowMemory iterations: %d\n"), iterations);
 
 #if ENABLE_PARTIAL_GC
@@ -2707,7 +2784,19 @@ Recycler::EndMarkOnLowMemory()
 bool
 Recycler::IsMarkStackEmpty()
 {
-    return (markContext.IsEmpty() && parallelMarkContext1.IsEmpty() && parallelMarkContext2.IsEmpty() && parallelMarkContext3.IsEmpty());
+    if (!markContext.IsEmpty())
+    {
+        return false;
+    }
+
+    for (uint i = 0; i < this->parallelMarkContextCount; i++)
+    {
+        if (!GetParallelMarkContext(i)->IsEmpty())
+        {
+            return false;
+        }
+    }
+    return true;
 }
 #endif
 
@@ -3509,7 +3598,7 @@ Recycler::DoCollectWrapped(CollectionFlags flags)
     BOOL collected = collectionWrapper->ExecuteRecyclerCollectionFunction(this, &Recycler::DoCollect, flags);
 
 #if ENABLE_CONCURRENT_GC
-    Assert(IsConcurrentExecutingState() || IsConcurrentFinishedState() || !CollectionInProgress());
+    Assert(IsConcurrentExecutingState() || IsConcurrentFinishedState() || IsIncrementalMarkState() || !CollectionInProgress());
 #else
     Assert(!CollectionInProgress());
 #endif
@@ -3698,6 +3787,11 @@ Recycler::DoCollect(CollectionFlags flags)
             Assert(!forceInThread);
             if (enableConcurrentMark)
             {
+                if (this->incrementalMarkBudget != 0 && StartIncrementalMarkCollect())
+                {
+                    return collected;
+                }
+
                 if (StartBackgroundMarkCollect())
                 {
                     // Tell the caller whether we have finish a collection and there maybe free object to reuse
@@ -4093,9 +4187,7 @@ Recycler::ProcessTrackedObjects()
 
     // If we did a parallel mark, we need to process any queued tracked objects from the parallel mark stack as well.
     // If we didn't, this will do nothing.
-    parallelMarkContext1.ProcessTracked();
-    parallelMarkContext2.ProcessTracked();
-    parallelMarkContext3.ProcessTracked();
+    ForEachParallelMarkContext([](MarkContext * context) { context->ProcessTracked(); });
 
     DebugOnly(this->isProcessingTrackedObjects = false);
 
@@ -4214,6 +4306,13 @@ Recycler::FinishConcurrent()
 
         const BOOL forceFinish = flags & CollectOverride_ForceFinish;
 
+        if (!forceFinish && IsIncrementalMarkState())
+        {
+            // Advance the mark by one slice; the collection is finished once the marking is done
+            IncrementalMarkSlice();
+            return false;
+        }
+
         if (forceFinish || !IsConcurrentExecutingState())
         {
             if (this->collectionState == CollectionStateConcurrentSweep)
@@ -4265,6 +4364,13 @@ Recycler::TryFinishConcurrentCollect()
     Assert(this->IsConcurrentEnabled());
     Assert(IsConcurrentState() || IsCollectionDisabled());
     Assert(!concurrent || !forceInThread);
+    if (concurrent && IsIncrementalMarkState())
+    {
+        // Marking happens on this thread; do another slice instead of finishing the mark in one pause
+        IncrementalMarkSlice();
+        return FinishDisposeObjectsWrapped<flags>();
+    }
+
     if (concurrent && concurrentThread != NULL)
     {
         if (IsConcurrentExecutingState())
@@ -4446,6 +4552,13 @@ bool Recycler::AbortConcurrent(bool restoreState)
     DWORD handleCount = (concurrentThread == NULL ? 1 : 2);
 
     DWORD ret = WAIT_OBJECT_0;
+    if (this->IsIncrementalMarkState())
+    {
+        // Nothing is running in the background. Abandon the mark the same way as a finished background mark.
+        this->collectionState = CollectionStateRescanWait;
+        SetEvent(this->concurrentWorkDoneEvent);
+    }
+
     if (this->IsConcurrentState())
     {
         this->isAborting = true;
@@ -4579,8 +4692,7 @@ Recycler::FinalizeConcurrent(bool restoreState)
 
     // Shutdown parallel threads and return the handle for them so the caller can
     // close it.
-    parallelThread1.Shutdown();
-    parallelThread2.Shutdown();
+    this->ShutdownParallelThreads(this->parallelThreadCount);
 
 #ifdef IDLE_DECOMMIT_ENABLED
     if (concurrentIdleDecommitEvent != nullptr)
@@ -4605,7 +4717,9 @@ Recycler::FinalizeConcurrent(bool restoreState)
         // Since we have shut down the concurrent thread, don't do a parallel mark.
         this->enableConcurrentMark = false;
         this->enableParallelMark = false;
+        this->enableParallelMarkWorkStealing = false;
         this->enableConcurrentSweep = false;
+        this->enableParallelSweep = false;
     }
 
     this->threadService = nullptr;
@@ -4641,6 +4755,14 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
         this->enableParallelMark = false;
     }
 
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+    this->enableParallelMarkWorkStealing = this->enableParallelMark && !CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::ParallelMarkWorkStealingPhase);
+    this->enableParallelSweep = this->enableParallelMark && this->enableConcurrentSweep && !CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::ParallelSweepPhase);
+#else
+    this->enableParallelMarkWorkStealing = this->enableParallelMark;
+    this->enableParallelSweep = this->enableParallelMark && this->enableConcurrentSweep;
+#endif
+
     if (threadService->HasCallback())
     {
         this->threadService = threadService;
@@ -4649,31 +4771,20 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
     else
     {
         bool startConcurrentThread = true;
-        bool startedParallelThread1 = false;
-        bool startedParallelThread2 = false;
+        uint startedParallelThreadCount = 0;
 
         if (startAllThreads)
         {
-            if (this->enableParallelMark && this->maxParallelism > 2)
+            if (this->enableParallelMark)
             {
-                if (!parallelThread1.EnableConcurrent(true))
+                while (startedParallelThreadCount < this->parallelThreadCount)
                 {
-                    startConcurrentThread = false;
-                }
-                else
-                {
-                    startedParallelThread1 = true;
-                    if (this->maxParallelism > 3)
+                    if (!this->parallelThreads[startedParallelThreadCount]->EnableConcurrent(true))
                     {
-                        if (!parallelThread2.EnableConcurrent(true))
-                        {
-                            startConcurrentThread = false;
-                        }
-                        else
-                        {
-                            startedParallelThread2 = true;
-                        }
+                        startConcurrentThread = false;
+                        break;
                     }
+                    startedParallelThreadCount++;
                 }
             }
         }
@@ -4697,20 +4808,15 @@ Recycler::EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllTh
             }
         }
 
-        if (startedParallelThread1)
-        {
-            parallelThread1.Shutdown();
-            if (startedParallelThread2)
-            {
-                parallelThread2.Shutdown();
-            }
-        }
+        this->ShutdownParallelThreads(startedParallelThreadCount);
     }
 
     // We failed to start a concurrent thread so we set these back to false and clean up
     this->enableConcurrentMark = false;
     this->enableParallelMark = false;
+    this->enableParallelMarkWorkStealing = false;
     this->enableConcurrentSweep = false;
+    this->enableParallelSweep = false;
 
     if (concurrentWorkReadyEvent)
     {
@@ -4883,6 +4989,119 @@ Recycler::StartSynchronousBackgroundMark()
     return StartBackgroundMark(true, true);
 }
 
+BOOL
+Recycler::StartIncrementalMarkCollect()
+{
+#ifdef RECYCLER_TRACE
+    PrintCollectTrace(Js::IncrementalMarkPhase);
+#endif
+    this->CollectionBegin<Js::ConcurrentCollectPhase>();
+
+    BOOL success = StartIncrementalMark();
+
+    this->CollectionEnd<Js::ConcurrentCollectPhase>();
+    return success;
+}
+
+BOOL
+Recycler::StartIncrementalMark()
+{
+    Assert(!this->CollectionInProgress());
+    Assert(this->enableConcurrentMark);
+
+    if (CUSTOM_PHASE_OFF1(GetRecyclerFlagsTable(), Js::IncrementalMarkPhase))
+    {
+        return false;
+    }
+
+    // Same setup as a background mark with foreground reset marks and find roots. The write watch
+    // is what lets the final rescan pick up the references the mutator changed between the slices.
+    RECYCLER_PROFILE_EXEC_BEGIN(this, Js::ResetWriteWatchPhase);
+    bool hasWriteWatch = (recyclerPageAllocator.ResetWriteWatch() && recyclerLargeBlockPageAllocator.ResetWriteWatch());
+    RECYCLER_PROFILE_EXEC_END(this, Js::ResetWriteWatchPhase);
+
+    if (!hasWriteWatch)
+    {
+        // Disable concurrent mark
+        this->enableConcurrentMark = false;
+        return false;
+    }
+
+    ResetMarks(this->enableScanImplicitRoots ? ResetMarkFlags_SynchronizedImplicitRoots : ResetMarkFlags_Synchronized);
+
+    this->collectionState = CollectionStateFindRoots;
+    FindRoots();
+    ScanStack();
+    Assert(collectionState == CollectionStateFindRoots);
+
+    this->StartQueueTrackedObject();
+    this->backgroundRescanCount = 0;
+    this->tickCountStartConcurrent = GetTickCount();
+
+    // The marking itself is done by IncrementalMarkSlice, whenever the collection would otherwise have
+    // tried to finish (allocation, script enter/exit and idle).
+    this->collectionState = CollectionStateIncrementalMark;
+    return true;
+}
+
+void
+Recycler::IncrementalMarkSlice()
+{
+    Assert(IsIncrementalMarkState());
+    Assert(this->DoQueueTrackedObject());
+
+    if (this->incrementalMarkBudget == 0)
+    {
+        // Incremental mark was turned off while we were marking
+        FinishIncrementalMark();
+        return;
+    }
+
+    RECYCLER_PROFILE_EXEC_BEGIN(this, Js::IncrementalMarkPhase);
+
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER deadline;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&deadline);
+    deadline.QuadPart += (this->incrementalMarkBudget * frequency.QuadPart) / 1000000;
+
+    bool drained = this->enableScanInteriorPointers ?
+        markContext.ProcessMarkSlice</* interior */ true>(deadline.QuadPart) :
+        markContext.ProcessMarkSlice</* interior */ false>(deadline.QuadPart);
+
+    RECYCLER_PROFILE_EXEC_END(this, Js::IncrementalMarkPhase);
+
+    if (drained)
+    {
+        EndIncrementalMark();
+    }
+}
+
+void
+Recycler::FinishIncrementalMark()
+{
+    Assert(IsIncrementalMarkState());
+    Assert(this->DoQueueTrackedObject());
+
+    ProcessMark(false);
+    EndIncrementalMark();
+}
+
+void
+Recycler::EndIncrementalMark()
+{
+    Assert(IsIncrementalMarkState());
+    Assert(!markContext.HasPendingMarkObjects());
+
+    CUSTOM_PHASE_PRINT_TRACE1(GetRecyclerFlagsTable(), Js::IncrementalMarkPhase, _u("Incremental mark done in %d ms\n"),
+        GetTickCount() - this->tickCountStartConcurrent);
+
+    // Hand off to FinishConcurrentCollect for the rescan and the sweep the same way the concurrent thread
+    // does at the end of a background mark. An OOM during the slices is handled by the rescan there too.
+    this->collectionState = CollectionStateRescanWait;
+    SetEvent(this->concurrentWorkDoneEvent);
+}
+
 BOOL
 Recycler::StartConcurrentSweepCollect()
 {
@@ -5337,6 +5556,12 @@ Recycler::FinishConcurrentCollect(CollectionFlags flags)
     collectionParam.priorityBoostConcurrentSweepOverride = priorityBoost;
 #endif
 
+    if (this->IsIncrementalMarkState())
+    {
+        // We need the mark finished now, complete the remaining slices in one go
+        FinishIncrementalMark();
+    }
+
     const DWORD waitTime = forceInThread? INFINITE : RecyclerHeuristic::FinishConcurrentCollectWaitTime(this->GetRecyclerFlagsTable());
     GCETW(GC_FINISHCONCURRENTWAIT_START, (this, waitTime));
     const BOOL waited = WaitForConcurrentThread(waitTime);
@@ -5671,6 +5896,12 @@ Recycler::ThreadProc()
 
     SetThreadPriority(::GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
 
+    if (this->numaNode != NUMA_NO_PREFERRED_NODE)
+    {
+        // Mark and sweep from the node the heap pages were placed on
+        AutoSystemInfo::SetCurrentThreadNumaAffinity(this->numaNode);
+    }
+
 #if defined(DBG) && defined(PROFILE_EXEC)
     this->backgroundProfilerPageAllocator.SetConcurrentThreadId(::GetCurrentThreadId());
 #endif
@@ -6102,13 +6333,12 @@ RecyclerParallelThread::EnableConcurrent(bool waitForThread)
 }
 
 
-template <uint parallelId>
 void
-Recycler::ParallelWorkFunc()
+Recycler::ParallelWorkFunc(uint parallelId)
 {
-    Assert(parallelId == 0 || parallelId == 1);
+    Assert(parallelId < this->parallelThreadCount);
 
-    MarkContext * markContext = (parallelId == 0 ? &this->parallelMarkContext2 : &this->parallelMarkContext3);
+    MarkContext * markContext = GetParallelMarkContext(parallelId + 1);
 
     switch (this->collectionState)
     {
@@ -6120,6 +6350,11 @@ Recycler::ParallelWorkFunc()
             this->ProcessParallelMark(true, markContext);
             break;
 
+        case CollectionStateConcurrentSweep:
+            Assert(this->recyclerSweep != nullptr);
+            this->recyclerSweep->ProcessParallelSweep();
+            break;
+
         default:
             Assert(false);
     }
@@ -6204,6 +6439,11 @@ RecyclerParallelThread::StaticThreadProc(LPVOID lpParameter)
         Assert(eventActivityIdControlResult == ERROR_SUCCESS);
 #endif
 
+        if (recycler->numaNode != NUMA_NO_PREFERRED_NODE)
+        {
+            AutoSystemInfo::SetCurrentThreadNumaAffinity(recycler->numaNode);
+        }
+
         // If this thread is created on demand we already have work to process and do not need to wait
         bool mustWait = parallelThread->synchronizeOnStartup;
 
@@ -6224,7 +6464,7 @@ RecyclerParallelThread::StaticThreadProc(LPVOID lpParameter)
             }
 
             // Invoke the workFunc to do real work
-            (recycler->*workFunc)();
+            (recycler->*workFunc)(parallelThread->parallelId);
 
             // We always wait after the first time
             mustWait = true;
@@ -6261,7 +6501,7 @@ RecyclerParallelThread::StaticBackgroundWorkCallback(void * callbackData)
     Recycler * recycler = parallelThread->recycler;
     RecyclerParallelThread::WorkFunc workFunc = parallelThread->workFunc;
 
-    (recycler->*workFunc)();
+    (recycler->*workFunc)(parallelThread->parallelId);
 
     SetEvent(parallelThread->concurrentWorkDoneEvent);
 }
@@ -6707,6 +6947,13 @@ Recycler::PrintMemoryStats()
         , collectionStats.numEmptySmallBlocks[HeapBlock::SmallLeafBlockType]
         + collectionStats.numEmptySmallBlocks[HeapBlock::MediumLeafBlockType],
         collectionStats.numZeroedOutSmallBlocks);
+
+    uint numSparseSmallBlocks = 0;
+    for (uint i = 0; i < HeapBlock::SmallBlockTypeCount; i++)
+    {
+        numSparseSmallBlocks += collectionStats.numSparseSmallBlocks[i];
+    }
+    Output::Print(_u("Number of sparse blocks moved to the end of the allocable list: %d\n"), numSparseSmallBlocks);
 }
 
 void
@@ -8138,6 +8385,17 @@ void Recycler::SetCheckFn(BOOL(*checkFn)(char* addr, size_t size))
     this->EnsureNotCollecting();
     this->checkFn = checkFn;
 }
+
+#if ENABLE_CONCURRENT_GC
+void Recycler::SetMaxParallelism(uint parallelism)
+{
+    // Only allows scaling down from (or back up to) the parallelism the recycler was initialized with,
+    // since the parallel mark contexts and threads are allocated in Initialize.
+    this->EnsureNotCollecting();
+    Assert(parallelism >= 2 && parallelism <= GetParallelismLimit());
+    this->maxParallelism = parallelism;
+}
+#endif
 #endif
 
 void
@@ -8190,13 +8448,14 @@ Recycler::NotifyFree(__in char *address, size_t size)
 #endif
 
 #ifdef RECYCLER_STATS
-    collectionStats.objectSweptCount++;
-    collectionStats.objectSweptBytes += size;
+    // Blocks may be swept concurrently by the parallel sweep threads
+    RECYCLER_STATS_INTERLOCKED_INC(this, objectSweptCount);
+    RECYCLER_STATS_INTERLOCKED_ADD(this, objectSweptBytes, size);
 
     if (!isForceSweeping)
     {
-        collectionStats.objectSweptFreeListCount++;
-        collectionStats.objectSweptFreeListBytes += size;
+        RECYCLER_STATS_INTERLOCKED_INC(this, objectSweptFreeListCount);
+        RECYCLER_STATS_INTERLOCKED_ADD(this, objectSweptFreeListBytes, size);
     }
 #endif
 }
@@ -487,6 +487,7 @@ struct RecyclerCollectionStats
 
     // Empty/zero heap block stats
     uint numEmptySmallBlocks[HeapBlock::SmallBlockTypeCount];
+    uint numSparseSmallBlocks[HeapBlock::SmallBlockTypeCount];
     uint numZeroedOutSmallBlocks;
 };
 #define RECYCLER_STATS_INC_IF(cond, r, f) if (cond) { RECYCLER_STATS_INC(r, f); }
@@ -569,11 +570,12 @@ struct CollectionParam
 class RecyclerParallelThread
 {
 public:
-    typedef void (Recycler::* WorkFunc)();
+    typedef void (Recycler::* WorkFunc)(uint parallelId);
 
-    RecyclerParallelThread(Recycler * recycler, WorkFunc workFunc) :
+    RecyclerParallelThread(Recycler * recycler, WorkFunc workFunc, uint parallelId) :
         recycler(recycler),
         workFunc(workFunc),
+        parallelId(parallelId),
         concurrentWorkReadyEvent(NULL),
         concurrentWorkDoneEvent(NULL),
         concurrentThread(NULL)
@@ -602,6 +604,7 @@ private:
 private:
     WorkFunc workFunc;
     Recycler * recycler;
+    uint parallelId;
     HANDLE concurrentWorkReadyEvent;// main thread uses this event to tell concurrent threads that the work is ready
     HANDLE concurrentWorkDoneEvent;// concurrent threads use this event to tell main thread that the work allocated is done
     HANDLE concurrentThread;
@@ -653,6 +656,7 @@ class Recycler
     friend struct ::XProcNumberPageSegmentManager;
 public:
     static const uint ConcurrentThreadStackSize = 300000;
+    static const uint MaxParallelism = PageStack<void *>::MaxSplitTargets + 1;    // main mark context + split targets
     static const bool FakeZeroLengthArray = true;
 
 #ifdef RECYCLER_PAGE_HEAP
@@ -719,6 +723,7 @@ private:
 #endif
     RecyclerPageAllocator recyclerPageAllocator;
     RecyclerPageAllocator recyclerLargeBlockPageAllocator;
+    DWORD numaNode;     // NUMA node the heap pages and background GC threads are placed on, or NUMA_NO_PREFERRED_NODE
 
     JsUtil::ThreadService *threadService;
 
@@ -812,21 +817,64 @@ private:
 
     MarkContext markContext;
 
+    // Page pool for above markContext
+    PagePool markPagePool;
+
     // Contexts for parallel marking.
-    // We support up to 4 way parallelism, main context + 3 additional parallel contexts.
-    MarkContext parallelMarkContext1;
-    MarkContext parallelMarkContext2;
-    MarkContext parallelMarkContext3;
+    // We support up to MaxParallelism way parallelism, main context + (maxParallelism - 1) additional parallel contexts.
+    // The main thread uses parallelMarkContexts[0] during in-thread parallel mark; parallel thread i always uses
+    // parallelMarkContexts[i + 1]. The contexts are allocated in Initialize once maxParallelism is known.
+    struct ParallelMarkContext
+    {
+        ParallelMarkContext(Recycler * recycler, Js::ConfigFlagsTable& flagsTable) :
+            pagePool(flagsTable),
+            markContext(recycler, &pagePool)
+        {
+        }
 
-    // Page pools for above markContexts
-    PagePool markPagePool;
-    PagePool parallelMarkPagePool1;
-    PagePool parallelMarkPagePool2;
-    PagePool parallelMarkPagePool3;
+        PagePool pagePool;
+        MarkContext markContext;
+    };
+
+    ParallelMarkContext * parallelMarkContexts[MaxParallelism - 1];
+    uint parallelMarkContextCount;
+
+    MarkContext * GetParallelMarkContext(uint index) const
+    {
+        Assert(index < this->parallelMarkContextCount);
+        return &this->parallelMarkContexts[index]->markContext;
+    }
+
+    template <typename Fn>
+    void ForEachParallelMarkContext(Fn fn) const
+    {
+        for (uint i = 0; i < this->parallelMarkContextCount; i++)
+        {
+            fn(GetParallelMarkContext(i));
+        }
+    }
+
+    template <typename Fn>
+    bool AnyMarkContext(Fn fn) const
+    {
+        if (fn(&this->markContext))
+        {
+            return true;
+        }
+
+        for (uint i = 0; i < this->parallelMarkContextCount; i++)
+        {
+            if (fn(GetParallelMarkContext(i)))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
 
     bool IsMarkStackEmpty();
-    bool HasPendingMarkObjects() const { return markContext.HasPendingMarkObjects() || parallelMarkContext1.HasPendingMarkObjects() || parallelMarkContext2.HasPendingMarkObjects() || parallelMarkContext3.HasPendingMarkObjects(); }
-    bool HasPendingTrackObjects() const { return markContext.HasPendingTrackObjects() || parallelMarkContext1.HasPendingTrackObjects() || parallelMarkContext2.HasPendingTrackObjects() || parallelMarkContext3.HasPendingTrackObjects(); }
+    bool HasPendingMarkObjects() const { return AnyMarkContext([](const MarkContext * context) { return context->HasPendingMarkObjects(); }); }
+    bool HasPendingTrackObjects() const { return AnyMarkContext([](const MarkContext * context) { return context->HasPendingTrackObjects(); }); }
 
     RecyclerCollectionWrapper * collectionWrapper;
 
@@ -942,6 +990,10 @@ private:
     bool enableConcurrentSweep;
 
     uint maxParallelism;        // Max # of total threads to run in parallel
+    bool enableParallelMarkWorkStealing;
+    bool enableParallelSweep;
+    ParallelMarkWorkQueue parallelMarkWorkQueue;
+    uint incrementalMarkBudget;             // microseconds per incremental mark slice, 0 if incremental mark is off
 
     byte backgroundRescanCount;             // for ETW events and stats
     byte backgroundFinishMarkCount;
@@ -950,11 +1002,13 @@ private:
     HANDLE concurrentWorkDoneEvent; // concurrent threads use this event to tell main thread that the work allocated is done
     HANDLE concurrentThread;
 
-    template <uint parallelId>
-    void ParallelWorkFunc();
+    void ParallelWorkFunc(uint parallelId);
+
+    // Parallel mark threads; the main thread and the concurrent thread make up the other two.
+    RecyclerParallelThread * parallelThreads[MaxParallelism - 2];
+    uint parallelThreadCount;
 
-    RecyclerParallelThread parallelThread1;
-    RecyclerParallelThread parallelThread2;
+    void ShutdownParallelThreads(uint threadCount);
 
 #if DBG
     // Variable indicating if the concurrent thread has exited or not
@@ -1103,6 +1157,7 @@ public:
 #endif
 
     void Prime();
+    void SetNumaNode(DWORD numaNode);
 
     void* GetOwnerContext() { return (void*) this->collectionWrapper; }
     PageAllocator * GetPageAllocator() { return threadPageAllocator; }
@@ -1121,9 +1176,7 @@ public:
     {
         this->needOOMRescan = false;
         markContext.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
-        parallelMarkContext1.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
-        parallelMarkContext2.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
-        parallelMarkContext3.GetPageAllocator()->ResetDisableAllocationOutOfMemory();
+        ForEachParallelMarkContext([](MarkContext * context) { context->GetPageAllocator()->ResetDisableAllocationOutOfMemory(); });
     }
 
     BOOL RequestConcurrentWrapperCallback();
@@ -1201,6 +1254,12 @@ public:
     BOOL FinishConcurrent();
     void ShutdownThread();
 
+    // Do the concurrent mark on this thread in slices of at most the given number of microseconds, relying on
+    // write watch to catch the references the mutator changes between slices. 0 goes back to background mark.
+    void SetIncrementalMarkBudget(uint microseconds) { this->incrementalMarkBudget = microseconds; }
+    uint GetIncrementalMarkBudget() const { return this->incrementalMarkBudget; }
+    BOOL IsIncrementalMarkState() const { return this->collectionState == CollectionStateIncrementalMark; }
+
     bool EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllThreads);
     void DisableConcurrent();
 
@@ -1254,6 +1313,11 @@ public:
 
 #ifdef RECYCLER_TEST_SUPPORT
     void SetCheckFn(BOOL(*checkFn)(char* addr, size_t size));
+#if ENABLE_CONCURRENT_GC
+    uint GetMaxParallelism() const { return this->enableParallelMark ? this->maxParallelism : 1; }
+    uint GetParallelismLimit() const { return this->parallelMarkContextCount + 1; }
+    void SetMaxParallelism(uint parallelism);
+#endif
 #endif
 
     void SetCollectionWrapper(RecyclerCollectionWrapper * wrapper)
@@ -1608,6 +1672,10 @@ private:
 #if ENABLE_CONCURRENT_GC
     void DoParallelMark();
     void DoBackgroundParallelMark();
+    void InitializeParallelMark();
+    uint StartParallelThreads(uint threadCount);
+    void WaitForParallelThreads(uint startedThreadCount);
+    void WaitForParallelMarkThreads(bool background, uint startedThreadCount, uint threadCount);
 #endif
 
     size_t RootMark(CollectionState markState);
@@ -1730,6 +1798,11 @@ private:
     BOOL StartSynchronousBackgroundMark();
     BOOL StartAsynchronousBackgroundMark();
     BOOL StartBackgroundMark(bool foregroundResetMark, bool foregroundFindRoots);
+    BOOL StartIncrementalMarkCollect();
+    BOOL StartIncrementalMark();
+    void IncrementalMarkSlice();
+    void FinishIncrementalMark();
+    void EndIncrementalMark();
     BOOL StartConcurrentSweepCollect();
 
     template <CollectionFlags flags>
@@ -183,3 +183,19 @@ RecyclerHeuristic::PartialConcurrentNextCollection(double ratio, Js::ConfigFlags
     return ratio >= 0.5;
 }
 #endif
+
+#if ENABLE_PARTIAL_GC
+uint
+RecyclerHeuristic::NurseryNewPageCount(Js::ConfigFlagsTable& flags)
+{
+    // 0 keeps the adaptive partial GC new page heuristic
+    const uint nurserySizeInMB = (uint)flags.RecyclerNurserySize;
+    if (nurserySizeInMB == 0)
+    {
+        return 0;
+    }
+
+    const uint maxNurserySizeInMB = RecyclerHeuristic::Instance.MaxPartialUncollectedNewPageCount / (1 MEGABYTES / AutoSystemInfo::PageSize);
+    return min(nurserySizeInMB, maxNurserySizeInMB) * (1 MEGABYTES / AutoSystemInfo::PageSize);
+}
+#endif
@@ -46,6 +46,10 @@ public:
 #if ENABLE_PARTIAL_GC && ENABLE_CONCURRENT_GC
     static bool PartialConcurrentNextCollection(double ratio, Js::ConfigFlagsTable& flags);
 #endif
+#if ENABLE_PARTIAL_GC
+    // Fixed number of new pages between partial collections, or 0 to scale it with AdjustPartialHeuristics
+    static uint NurseryNewPageCount(Js::ConfigFlagsTable& flags);
+#endif
 
     // Constant heuristics
     static const uint IdleUncollectedAllocBytesCollection = 1 MEGABYTES;
@@ -29,6 +29,26 @@ bool RecyclerPageAllocator::IsMemProtectMode()
     return recycler->IsMemProtectMode();
 }
 
+#if ENABLE_HUGE_PAGE_SEGMENTS
+void
+RecyclerPageAllocator::EnableHugePageSegments()
+{
+    Assert(segments.Empty());
+    Assert(fullSegments.Empty());
+    Assert(emptySegments.Empty());
+    Assert(decommitSegments.Empty());
+    Assert(largeSegments.Empty());
+    Assert(secondaryAllocPageCount == 0);
+
+    // Make each page segment exactly one 2MB huge page. Guard pages would shift the segment off
+    // the huge page boundary, and MEM_LARGE_PAGES asks the PAL for an aligned, THP-advised reservation.
+    maxAllocPageCount = HugePageSegmentPageCount;
+    excludeGuardPages = true;
+    allocFlags |= MEM_LARGE_PAGES;
+    hugePageSegments = true;
+}
+#endif
+
 #if ENABLE_CONCURRENT_GC
 void
 RecyclerPageAllocator::EnableWriteWatch()
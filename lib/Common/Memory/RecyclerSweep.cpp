@@ -50,6 +50,7 @@ RecyclerSweep::BeginSweep(Recycler * recycler)
     memset(this, 0, sizeof(RecyclerSweep));
     this->recycler = recycler;
     recycler->recyclerSweep = this;
+    this->sparseHeapBlockMarkPercent = (uint)min(100, max(0, (int)recycler->GetRecyclerFlagsTable().RecyclerSparseBlockThreshold));
 
     // We might still have block that has disposed but not put back into the allocable
     // heap block list yet, which happens if we finish disposing object during concurrent
@@ -179,6 +180,7 @@ RecyclerSweep::FinishSweep()
                 Output::Print(_u("AdjustPartialHeuristics returned true\n"));
                 Output::Print(_u("  partialUncollectedAllocBytes = %d\n"), recycler->partialUncollectedAllocBytes);
                 Output::Print(_u("  nextPartialUncollectedAllocBytes = %d\n"), this->nextPartialUncollectedAllocBytes);
+                Output::Print(_u("  uncollectedNewPageCountPartialCollect = %d\n"), recycler->uncollectedNewPageCountPartialCollect);
             }
 #endif
 
@@ -450,6 +452,164 @@ RecyclerSweep::EndBackground()
     this->background = false;
 }
 
+bool
+RecyclerSweep::DoParallelSweep() const
+{
+    // Only the background sweep of the pending sweep blocks is split across the parallel threads
+    if (!this->IsBackground() || !recycler->enableParallelSweep || recycler->parallelThreadCount == 0)
+    {
+        return false;
+    }
+
+#if ENABLE_PARTIAL_GC
+    // In partial collect mode the pending sweep blocks are not reused and not actually swept
+    if (recycler->inPartialCollectMode)
+    {
+        return false;
+    }
+#endif
+
+    // Recycler::NotifyFree reports every swept object, and the listeners aren't thread safe
+#ifdef RECYCLER_PERF_COUNTERS
+    return false;
+#else
+#ifdef ENABLE_JS_ETW
+    if (EventEnabledJSCRIPT_RECYCLER_FREE_MEMORY())
+    {
+        return false;
+    }
+#endif
+#ifdef RECYCLER_TEST_SUPPORT
+    if (BinaryFeatureControl::RecyclerTest() && recycler->checkFn != nullptr)
+    {
+        return false;
+    }
+#endif
+    return !RecyclerMemoryTracking::IsActive();
+#endif
+}
+
+template <typename TBlockType>
+uint
+RecyclerSweep::GetPendingSweepBlocks(SmallHeapBlockT<typename TBlockType::HeapBlockAttributes> ** heapBlocks)
+{
+    // Count the pending sweep blocks of the buckets, and store them in heapBlocks if it is given
+    uint count = 0;
+    Data<TBlockType>& data = this->GetData<TBlockType>();
+    for (uint i = 0; i < TBlockType::HeapBlockAttributes::BucketCount; i++)
+    {
+        HeapBlockList::ForEach(data.bucketData[i].pendingSweepList, [heapBlocks, &count](TBlockType * heapBlock)
+        {
+            Assert(heapBlock->IsPendingConcurrentSweep());
+            if (heapBlocks != nullptr)
+            {
+                heapBlocks[count] = heapBlock;
+            }
+            count++;
+        });
+    }
+    return count;
+}
+
+/*--------------------------------------------------------------------------------------------
+ * Sweep the objects of the pending sweep blocks on the background thread and the parallel
+ * threads. The blocks are handed out through an interlocked index, so no lock is taken.
+ * The blocks stay on the pending sweep lists; SweepPendingObjects of each bucket then only
+ * relinks them since they are no longer pending concurrent sweep.
+ *--------------------------------------------------------------------------------------------*/
+void
+RecyclerSweep::ParallelSweepPendingObjects()
+{
+    if (!this->DoParallelSweep())
+    {
+        return;
+    }
+
+    uint smallBlockCount = this->GetPendingSweepBlocks<SmallNormalHeapBlock>(nullptr);
+    uint mediumBlockCount = this->GetPendingSweepBlocks<MediumNormalHeapBlock>(nullptr);
+#ifdef RECYCLER_WRITE_BARRIER
+    smallBlockCount += this->GetPendingSweepBlocks<SmallNormalWithBarrierHeapBlock>(nullptr);
+    mediumBlockCount += this->GetPendingSweepBlocks<MediumNormalWithBarrierHeapBlock>(nullptr);
+#endif
+
+    if (smallBlockCount + mediumBlockCount < MinParallelSweepBlockCount)
+    {
+        return;
+    }
+
+    // If we can't get the memory, just sweep the blocks in the buckets as usual
+    SmallHeapBlock ** smallBlocks = HeapNewNoThrowArray(SmallHeapBlock *, smallBlockCount);
+    MediumHeapBlock ** mediumBlocks = HeapNewNoThrowArray(MediumHeapBlock *, mediumBlockCount);
+    if (smallBlocks != nullptr && mediumBlocks != nullptr)
+    {
+        uint count = this->GetPendingSweepBlocks<SmallNormalHeapBlock>(smallBlocks);
+#ifdef RECYCLER_WRITE_BARRIER
+        count += this->GetPendingSweepBlocks<SmallNormalWithBarrierHeapBlock>(smallBlocks + count);
+#endif
+        Assert(count == smallBlockCount);
+
+        count = this->GetPendingSweepBlocks<MediumNormalHeapBlock>(mediumBlocks);
+#ifdef RECYCLER_WRITE_BARRIER
+        count += this->GetPendingSweepBlocks<MediumNormalWithBarrierHeapBlock>(mediumBlocks + count);
+#endif
+        Assert(count == mediumBlockCount);
+
+        this->parallelSweepSmallBlocks = smallBlocks;
+        this->parallelSweepMediumBlocks = mediumBlocks;
+        this->parallelSweepSmallBlockCount = smallBlockCount;
+        this->parallelSweepMediumBlockCount = mediumBlockCount;
+        this->parallelSweepNextBlock = 0;
+
+        // Each thread sweeps a block at a time, so there is no point in starting more threads than blocks
+        const uint threadCount = min(recycler->parallelThreadCount, smallBlockCount + mediumBlockCount - 1);
+        const uint startedThreadCount = recycler->StartParallelThreads(threadCount);
+
+        this->ProcessParallelSweep();
+
+        recycler->WaitForParallelThreads(startedThreadCount);
+
+        Assert((uint)this->parallelSweepNextBlock >= smallBlockCount + mediumBlockCount);
+        this->parallelSweepSmallBlocks = nullptr;
+        this->parallelSweepMediumBlocks = nullptr;
+        this->parallelSweepSmallBlockCount = 0;
+        this->parallelSweepMediumBlockCount = 0;
+    }
+
+    if (smallBlocks != nullptr)
+    {
+        HeapDeleteArray(smallBlockCount, smallBlocks);
+    }
+    if (mediumBlocks != nullptr)
+    {
+        HeapDeleteArray(mediumBlockCount, mediumBlocks);
+    }
+}
+
+void
+RecyclerSweep::ProcessParallelSweep()
+{
+    const uint smallBlockCount = this->parallelSweepSmallBlockCount;
+    const uint blockCount = smallBlockCount + this->parallelSweepMediumBlockCount;
+
+    while (true)
+    {
+        const uint index = (uint)::InterlockedIncrement(&this->parallelSweepNextBlock) - 1;
+        if (index >= blockCount)
+        {
+            break;
+        }
+
+        if (index < smallBlockCount)
+        {
+            this->parallelSweepSmallBlocks[index]->SweepObjects<SweepMode_Concurrent>(recycler);
+        }
+        else
+        {
+            this->parallelSweepMediumBlocks[index - smallBlockCount]->SweepObjects<SweepMode_Concurrent>(recycler);
+        }
+    }
+}
+
 #if DBG
 bool
 RecyclerSweep::HasPendingNewHeapBlocks() const
@@ -579,6 +739,21 @@ RecyclerSweep::AddUnaccountedNewObjectAllocBytes(SmallHeapBlockT<TBlockAttribute
 template void RecyclerSweep::AddUnaccountedNewObjectAllocBytes<SmallAllocationBlockAttributes>(SmallHeapBlock * heapBlock);
 template void RecyclerSweep::AddUnaccountedNewObjectAllocBytes<MediumAllocationBlockAttributes>(MediumHeapBlock * heapBlock);
 
+// Called by the heap bucket on a swept block to decide whether it should go to the end of the
+// allocable block list. Allocating into denser blocks first leaves the sparse ones a chance to
+// lose their remaining objects, at which point the block is freed and its pages released.
+// The recycler doesn't move objects, so this is the only way to reclaim a fragmented block.
+template <typename TBlockAttributes>
+bool
+RecyclerSweep::IsSparseHeapBlock(SmallHeapBlockT<TBlockAttributes> * heapBlock) const
+{
+    // The mark count is the number of live objects left in the block after sweep
+    return heapBlock->GetMarkedCount() * 100 < heapBlock->GetObjectCount() * this->sparseHeapBlockMarkPercent;
+}
+
+template bool RecyclerSweep::IsSparseHeapBlock<SmallAllocationBlockAttributes>(SmallHeapBlock * heapBlock) const;
+template bool RecyclerSweep::IsSparseHeapBlock<MediumAllocationBlockAttributes>(MediumHeapBlock * heapBlock) const;
+
 #if ENABLE_PARTIAL_GC
 void
 RecyclerSweep::SubtractSweepNewObjectAllocBytes(size_t newObjectExpectSweepByteCount)
@@ -713,6 +888,15 @@ RecyclerSweep::AdjustPartialHeuristics()
     recycler->uncollectedNewPageCountPartialCollect = MinPartialUncollectedNewPageCount
         + (size_t)((double)(RecyclerHeuristic::Instance.MaxPartialUncollectedNewPageCount - MinPartialUncollectedNewPageCount) * ratio);
 
+    // With a fixed nursery size, trigger the next partial collect once that many new pages are allocated,
+    // so short-lived objects are reclaimed early and the cost of the partial collect stays proportional to
+    // the surviving new objects and the dirty pages to rescan.
+    const uint nurseryNewPageCount = RecyclerHeuristic::NurseryNewPageCount(recycler->GetRecyclerFlagsTable());
+    if (nurseryNewPageCount != 0)
+    {
+        recycler->uncollectedNewPageCountPartialCollect = max(nurseryNewPageCount, MinPartialUncollectedNewPageCount);
+    }
+
     Assert(recycler->uncollectedNewPageCountPartialCollect >= MinPartialUncollectedNewPageCount &&
         recycler->uncollectedNewPageCountPartialCollect <= RecyclerHeuristic::Instance.MaxPartialUncollectedNewPageCount);
 
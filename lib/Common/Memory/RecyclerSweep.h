@@ -40,6 +40,9 @@ public:
     void BeginBackground(bool forceForeground);
     void EndBackground();
 
+    void ParallelSweepPendingObjects();
+    void ProcessParallelSweep();
+
     template <typename TBlockType> void SetPendingMergeNewHeapBlockList(TBlockType * heapBlockList);
     template <typename TBlockType> void MergePendingNewHeapBlockList();
     template <typename TBlockType> void MergePendingNewMediumHeapBlockList();
@@ -56,6 +59,8 @@ public:
 
     template <typename TBlockAttributes>
     void AddUnaccountedNewObjectAllocBytes(SmallHeapBlockT<TBlockAttributes> * smallHeapBlock);
+    template <typename TBlockAttributes>
+    bool IsSparseHeapBlock(SmallHeapBlockT<TBlockAttributes> * smallHeapBlock) const;
 #if ENABLE_PARTIAL_GC
     bool InPartialCollectMode() const;
     bool InPartialCollect() const;
@@ -137,6 +142,14 @@ private:
 
 private:
     bool IsMemProtectMode();
+#if ENABLE_CONCURRENT_GC
+    bool DoParallelSweep() const;
+    template <typename TBlockType>
+    uint GetPendingSweepBlocks(SmallHeapBlockT<typename TBlockType::HeapBlockAttributes> ** heapBlocks);
+
+    // Don't bother waking up the parallel threads for only a few blocks
+    static const uint MinParallelSweepBlockCount = 64;
+#endif
 
     Recycler * recycler;
     Data<SmallLeafHeapBlock> leafData;
@@ -154,10 +167,21 @@ private:
     Data<MediumFinalizableWithBarrierHeapBlock> mediumFinalizableWithBarrierData;
 #endif
 
+    // Swept blocks with a lower percentage of live objects are allocated from last
+    uint sparseHeapBlockMarkPercent;
+
     bool background;
     bool forceForeground;
     bool hasPendingSweepSmallHeapBlocks;
     bool hasPendingEmptyBlocks;
+#if ENABLE_CONCURRENT_GC
+    // Pending sweep blocks handed out to the background and parallel threads by ProcessParallelSweep
+    SmallHeapBlock ** parallelSweepSmallBlocks;
+    MediumHeapBlock ** parallelSweepMediumBlocks;
+    uint parallelSweepSmallBlockCount;
+    uint parallelSweepMediumBlockCount;
+    LONG volatile parallelSweepNextBlock;
+#endif
     bool inPartialCollect;
 #if ENABLE_PARTIAL_GC
     bool adjustPartialHeuristics;
@@ -256,9 +256,26 @@ SmallNormalHeapBucketBase<TBlockType>::SweepPendingObjects(RecyclerSweep& recycl
             // We decided not to do a partial sweep.
             // Blocks in the pendingSweepList need to have a regular sweep.
 
-            TBlockType * tail = SweepPendingObjects<SweepMode_Concurrent>(recycler, list);
-            tail->SetNextBlock(this->heapBlockList);
-            this->heapBlockList = list;
+            SweepPendingObjects<SweepMode_Concurrent>(recycler, list);
+
+            // Like SweepHeapBlockList, put the swept blocks ahead of the allocable list, except for
+            // the sparse ones, which go to the end so that they can drain
+            TBlockType * sparseBlockList = nullptr;
+            HeapBlockList::ForEachEditing(list, [=, &recyclerSweep, &sparseBlockList](TBlockType * heapBlock)
+            {
+                if (recyclerSweep.IsSparseHeapBlock(heapBlock))
+                {
+                    heapBlock->SetNextBlock(sparseBlockList);
+                    sparseBlockList = heapBlock;
+                    RECYCLER_STATS_INC(recycler, numSparseSmallBlocks[heapBlock->GetHeapBlockType()]);
+                }
+                else
+                {
+                    heapBlock->SetNextBlock(this->heapBlockList);
+                    this->heapBlockList = heapBlock;
+                }
+            });
+            this->AppendSparseHeapBlockList(sparseBlockList);
 
             this->StartAllocationAfterSweep();
         }
@@ -278,7 +295,11 @@ SmallNormalHeapBucketBase<TBlockType>::SweepPendingObjects(Recycler * recycler,
     HeapBlockList::ForEach(list, [recycler, &tail](TBlockType * heapBlock)
     {
         // Note, page heap blocks are never swept concurrently
-        heapBlock->template SweepObjects<mode>(recycler);
+        // Blocks already swept by RecyclerSweep::ParallelSweepPendingObjects just need to be relinked
+        if (heapBlock->IsPendingConcurrentSweep())
+        {
+            heapBlock->template SweepObjects<mode>(recycler);
+        }
         tail = heapBlock;
     });
     return tail;
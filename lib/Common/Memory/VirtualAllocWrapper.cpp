@@ -10,7 +10,7 @@
 
 VirtualAllocWrapper VirtualAllocWrapper::Instance;  // single instance
 
-LPVOID VirtualAllocWrapper::Alloc(LPVOID lpAddress, size_t dwSize, DWORD allocationType, DWORD protectFlags, bool isCustomHeapAllocation, HANDLE process)
+LPVOID VirtualAllocWrapper::Alloc(LPVOID lpAddress, size_t dwSize, DWORD allocationType, DWORD protectFlags, bool isCustomHeapAllocation, HANDLE process, DWORD preferredNumaNode)
 {
     LPVOID address = nullptr;
 
@@ -72,7 +72,14 @@ LPVOID VirtualAllocWrapper::Alloc(LPVOID lpAddress, size_t dwSize, DWORD allocat
     else
 #endif
     {
-        address = VirtualAllocEx(process, lpAddress, dwSize, allocationType, protectFlags);
+        if (preferredNumaNode != NUMA_NO_PREFERRED_NODE)
+        {
+            address = VirtualAllocExNuma(process, lpAddress, dwSize, allocationType, protectFlags, preferredNumaNode);
+        }
+        else
+        {
+            address = VirtualAllocEx(process, lpAddress, dwSize, allocationType, protectFlags);
+        }
         if (address == nullptr)
         {
             MemoryOperationLastError::RecordLastError();
@@ -281,7 +288,7 @@ LPVOID PreReservedVirtualAllocWrapper::EnsurePreReservedRegionInternal()
 *   -   Tracks the committed pages
 */
 
-LPVOID PreReservedVirtualAllocWrapper::Alloc(LPVOID lpAddress, size_t dwSize, DWORD allocationType, DWORD protectFlags, bool isCustomHeapAllocation, HANDLE process)
+LPVOID PreReservedVirtualAllocWrapper::Alloc(LPVOID lpAddress, size_t dwSize, DWORD allocationType, DWORD protectFlags, bool isCustomHeapAllocation, HANDLE process, DWORD preferredNumaNode)
 {
     Assert(process == this->processHandle);
     AssertMsg(isCustomHeapAllocation, "PreReservation used for allocations other than CustomHeap?");
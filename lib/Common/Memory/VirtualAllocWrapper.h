@@ -16,7 +16,7 @@ namespace Memory
 class VirtualAllocWrapper
 {
 public:
-    LPVOID  Alloc(LPVOID lpAddress, DECLSPEC_GUARD_OVERFLOW size_t dwSize, DWORD allocationType, DWORD protectFlags, bool isCustomHeapAllocation, HANDLE process);
+    LPVOID  Alloc(LPVOID lpAddress, DECLSPEC_GUARD_OVERFLOW size_t dwSize, DWORD allocationType, DWORD protectFlags, bool isCustomHeapAllocation, HANDLE process, DWORD preferredNumaNode = NUMA_NO_PREFERRED_NODE);
     BOOL    Free(LPVOID lpAddress, size_t dwSize, DWORD dwFreeType, HANDLE process);
 
     static VirtualAllocWrapper Instance;  // single instance
@@ -46,7 +46,8 @@ public:
 public:
     PreReservedVirtualAllocWrapper(HANDLE process);
     ~PreReservedVirtualAllocWrapper();
-    LPVOID      Alloc(LPVOID lpAddress, DECLSPEC_GUARD_OVERFLOW size_t dwSize, DWORD allocationType, DWORD protectFlags, bool isCustomHeapAllocation, HANDLE process);
+    // The pre-reserved region is already placed; preferredNumaNode is ignored
+    LPVOID      Alloc(LPVOID lpAddress, DECLSPEC_GUARD_OVERFLOW size_t dwSize, DWORD allocationType, DWORD protectFlags, bool isCustomHeapAllocation, HANDLE process, DWORD preferredNumaNode = NUMA_NO_PREFERRED_NODE);
     BOOL        Free(LPVOID lpAddress,  size_t dwSize, DWORD dwFreeType, HANDLE process);
 
     bool        IsInRange(void * address);
@@ -586,7 +586,8 @@ typedef struct FunctionJITTimeDataIDL
 {
     boolean isAggressiveInliningEnabled;
     boolean isInlined;
-    IDL_PAD2(0)
+    boolean hasPolymorphicTail;
+    IDL_PAD1(0)
     unsigned int localFuncId;
     FunctionBodyDataIDL * bodyData; // TODO: oop jit, can these repeat, should we share?
 
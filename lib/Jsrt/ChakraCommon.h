@@ -424,7 +424,13 @@ typedef UINT32 DWORD;
         ///     Calling <c>JsSetException</c> will also dispatch the exception to the script debugger
         ///     (if any) giving the debugger a chance to break on the exception.
         /// </summary>
-        JsRuntimeAttributeDispatchSetExceptionsToDebugger = 0x00000040
+        JsRuntimeAttributeDispatchSetExceptionsToDebugger = 0x00000040,
+        /// <summary>
+        ///     The runtime will allocate its garbage collected heap from the NUMA node of the thread
+        ///     that first uses it, and run its background garbage collection threads on that node.
+        ///     Has no effect on systems with a single NUMA node.
+        /// </summary>
+        JsRuntimeAttributeEnableNumaAffinity = 0x00000080
     } JsRuntimeAttributes;
 
     /// <summary>
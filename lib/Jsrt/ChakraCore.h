@@ -552,5 +552,222 @@ CHAKRA_API
         _In_ JsSourceContext sourceContext,
         _In_ JsValueRef sourceUrl,
         _Out_ JsValueRef *result);
+
+/// <summary>
+///     Parses a script serialized into a file and returns a function representing the script.
+///     Provides the ability to lazy load the script source only if/when it is needed.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context.
+///     </para>
+///     <para>
+///     The file is memory mapped rather than read. Byte code and string constants are used in
+///     place, and functions that never run are never deserialized, so their pages are never
+///     read. Runtimes in different processes that map the same file share its pages.
+///     </para>
+///     <para>
+///     Each file is mapped once per runtime and stays mapped until the runtime is disposed. It
+///     must hold a buffer produced by <c>JsSerialize</c> with the same build of the engine, and
+///     must not be modified while it is mapped. Replace it with a new file instead, at the same
+///     or another path; a replaced file is recognized by its identity and mapped again.
+///     </para>
+/// </remarks>
+/// <param name="path">The path of the file holding the serialized script.</param>
+/// <param name="scriptLoadCallback">Callback called when the source code of the script needs to be loaded.</param>
+/// <param name="sourceContext">
+///     A cookie identifying the script that can be used by debuggable script contexts.
+///     This context will passed into scriptLoadCallback.
+/// </param>
+/// <param name="sourceUrl">The location the script came from.</param>
+/// <param name="result">A function representing the script code.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorInvalidArgument</c> if
+///     the file could not be mapped or is shorter than the buffer it holds, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsParseSerializedFile(
+        _In_ JsValueRef path,
+        _In_ JsSerializedLoadScriptCallback scriptLoadCallback,
+        _In_ JsSourceContext sourceContext,
+        _In_ JsValueRef sourceUrl,
+        _Out_ JsValueRef *result);
+
+/// <summary>
+///     Runs a script serialized into a file.
+///     Provides the ability to lazy load the script source only if/when it is needed.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context.
+///     </para>
+///     <para>
+///     The file is mapped as described for <c>JsParseSerializedFile</c>.
+///     </para>
+/// </remarks>
+/// <param name="path">The path of the file holding the serialized script.</param>
+/// <param name="scriptLoadCallback">Callback called when the source code of the script needs to be loaded.</param>
+/// <param name="sourceContext">
+///     A cookie identifying the script that can be used by debuggable script contexts.
+///     This context will passed into scriptLoadCallback.
+/// </param>
+/// <param name="sourceUrl">The location the script came from.</param>
+/// <param name="result">
+///     The result of running the script, if any. This parameter can be null.
+/// </param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorInvalidArgument</c> if
+///     the file could not be mapped or is shorter than the buffer it holds, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsRunSerializedFile(
+        _In_ JsValueRef path,
+        _In_ JsSerializedLoadScriptCallback scriptLoadCallback,
+        _In_ JsSourceContext sourceContext,
+        _In_ JsValueRef sourceUrl,
+        _Out_ JsValueRef *result);
+
+/// <summary>
+///     Compiles a bootstrap script into a snapshot that new contexts of the runtime can run
+///     without parsing it again.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context. The script is compiled, not run.
+///     </para>
+///     <para>
+///     The runtime keeps a copy of the script and of its serialized byte code until it is
+///     disposed. <c>JsRunContextSnapshot</c> deserializes the byte code in place, as for
+///     <c>JsRunSerializedFile</c>: string constants are not copied, and functions are only
+///     deserialized when they are first called. The script still runs in every context, so
+///     the objects it creates are built again each time.
+///     </para>
+/// </remarks>
+/// <param name="script">The script, as a string or an external array buffer.</param>
+/// <param name="sourceUrl">The location the script came from. Identifies the snapshot in the runtime.</param>
+/// <param name="parseAttributes">Attribute mask for parsing the script.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorInvalidArgument</c> if
+///     the runtime already has a snapshot for <paramref name="sourceUrl" />, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsCreateContextSnapshot(
+        _In_ JsValueRef script,
+        _In_ JsValueRef sourceUrl,
+        _In_ JsParseScriptAttributes parseAttributes);
+
+/// <summary>
+///     Runs a snapshot created by <c>JsCreateContextSnapshot</c> in the current context.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context of the runtime the snapshot was created in.
+///     </para>
+/// </remarks>
+/// <param name="sourceUrl">The location the snapshot was created with.</param>
+/// <param name="result">
+///     The result of running the script, if any. This parameter can be null.
+/// </param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorInvalidArgument</c> if
+///     the runtime has no snapshot for <paramref name="sourceUrl" />, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsRunContextSnapshot(
+        _In_ JsValueRef sourceUrl,
+        _Out_opt_ JsValueRef *result);
+
+/// <summary>
+///     Sets the longest pause, in microseconds, that garbage collection marking may take on the
+///     runtime's thread.
+/// </summary>
+/// <remarks>
+///     <para>
+///     With a non-zero budget, full collections no longer mark on a background thread. Marking
+///     is done on the runtime's thread in slices of at most <paramref name="microseconds" />,
+///     interleaved with script execution. Changes that script makes between slices are picked
+///     up by a final rescan before the sweep. A budget of 0 turns incremental marking off.
+///     </para>
+///     <para>
+///     If the runtime was created with <c>JsRuntimeAttributeEnableIdleProcessing</c>, each call
+///     to <c>JsIdle</c> runs one slice while a collection is being marked, and returns a next
+///     idle tick that asks the host to call <c>JsIdle</c> again right away.
+///     </para>
+///     <para>
+///     On platforms without concurrent garbage collection, the budget is ignored and marking
+///     always completes in a single pause.
+///     </para>
+/// </remarks>
+/// <param name="runtime">The runtime whose pause budget is to be set.</param>
+/// <param name="microseconds">The pause budget for each marking slice, or 0 to turn incremental marking off.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetRuntimeGCPauseBudget(
+        _In_ JsRuntimeHandle runtime,
+        _In_ unsigned int microseconds);
+
+/// <summary>
+///     Serializes the dynamic profile collected for the scripts run with a source context.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context.
+///     </para>
+///     <para>
+///     The profile records which functions of the scripts ran and the type information gathered
+///     while they were interpreted. Passing it to <c>JsLoadProfile</c> in a later process lets
+///     the same scripts skip profiling and go to the optimizing JIT sooner.
+///     </para>
+///     <para>
+///     The format is only valid for the exact same build of the engine, and only for the same
+///     script source. Mismatched profiles are rejected by <c>JsLoadProfile</c> or ignored
+///     function by function.
+///     </para>
+///     <para>
+///     If buffer is null, the required size is returned in bufferSize.
+///     </para>
+/// </remarks>
+/// <param name="sourceContext">The cookie the scripts were run with.</param>
+/// <param name="buffer">The buffer to put the serialized profile into. Can be null.</param>
+/// <param name="bufferSize">
+///     On entry, the size of the buffer, in bytes; on exit, the size of the buffer, in bytes,
+///     required to hold the serialized profile.
+/// </param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorInvalidArgument</c> if no
+///     profile was collected for the source context, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSerializeProfile(
+        _In_ JsSourceContext sourceContext,
+        _Out_writes_to_opt_(*bufferSize, *bufferSize) BYTE *buffer,
+        _Inout_ unsigned int *bufferSize);
+
+/// <summary>
+///     Loads a dynamic profile serialized by <c>JsSerializeProfile</c> for a source context.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context.
+///     </para>
+///     <para>
+///     Must be called before any script is run with the source context in the current script
+///     context. The profile is copied; the buffer can be freed when the call returns.
+///     </para>
+/// </remarks>
+/// <param name="sourceContext">The cookie the scripts will be run with.</param>
+/// <param name="buffer">The serialized profile.</param>
+/// <param name="bufferSize">The size of the serialized profile, in bytes.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorBadSerializedScript</c> if
+///     the profile is corrupt or was serialized by a different build, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsLoadProfile(
+        _In_ JsSourceContext sourceContext,
+        _In_reads_bytes_(bufferSize) const BYTE *buffer,
+        _In_ unsigned int bufferSize);
 #endif // NTBUILD
 #endif // _CHAKRACORE_H_
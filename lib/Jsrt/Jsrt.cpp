@@ -247,7 +247,8 @@ JsErrorCode CreateRuntimeCore(_In_ JsRuntimeAttributes attributes,
             JsRuntimeAttributeDisableEval |
             JsRuntimeAttributeDisableNativeCodeGeneration |
             JsRuntimeAttributeEnableExperimentalFeatures |
-            JsRuntimeAttributeDispatchSetExceptionsToDebugger
+            JsRuntimeAttributeDispatchSetExceptionsToDebugger |
+            JsRuntimeAttributeEnableNumaAffinity
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
             | JsRuntimeAttributeSerializeLibraryByteCode
 #endif
@@ -299,6 +300,11 @@ JsErrorCode CreateRuntimeCore(_In_ JsRuntimeAttributes attributes,
             threadContext->SetThreadContextFlag(ThreadContextFlagNoJIT);
         }
 
+        if (attributes & JsRuntimeAttributeEnableNumaAffinity)
+        {
+            threadContext->SetThreadContextFlag(ThreadContextFlagNumaAffinity);
+        }
+
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
         if (Js::Configuration::Global.flags.PrimeRecycler)
         {
@@ -3214,7 +3220,7 @@ JsErrorCode RunSerializedScriptCore(
     JsSourceContext scriptLoadSourceContext, // only used by scriptLoadCallback
     unsigned char *buffer,
     JsSourceContext sourceContext, const wchar_t *sourceUrl,
-    bool parseOnly, JsValueRef *result)
+    bool parseOnly, JsValueRef *result, bool isBufferPinned = false)
 {
     Js::JavascriptFunction *function;
     JsErrorCode errorCode = ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
@@ -3266,6 +3272,11 @@ JsErrorCode RunSerializedScriptCore(
             flags = fscrAllowFunctionProxy;
         }
 
+        if (isBufferPinned)
+        {
+            flags |= fscrPinnedByteCode;
+        }
+
         hsi = scriptContext->AddHostSrcInfo(&si);
         hr = Js::ByteCodeSerializer::DeserializeFromBuffer(scriptContext, flags, sourceHolder,
             hsi, buffer, nullptr, &functionBody);
@@ -4514,4 +4525,304 @@ CHAKRA_API JsRunSerialized(
         sourceContext, // use the same user provided sourceContext as scriptLoadSourceContext
         buffer, sourceContext, url, false, result);
 }
+
+static JsErrorCode RunSerializedFileCore(
+    JsValueRef path,
+    JsSerializedLoadScriptCallback scriptLoadCallback,
+    JsSourceContext sourceContext,
+    JsValueRef sourceUrl,
+    bool parseOnly, JsValueRef *result)
+{
+    PARAM_NOT_NULL(path);
+    PARAM_NOT_NULL(sourceUrl);
+
+    if (!Js::JavascriptString::Is(path) || !Js::JavascriptString::Is(sourceUrl))
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    JsrtContext * context = JsrtContext::GetCurrent();
+    if (context == nullptr)
+    {
+        return JsErrorNoCurrentContext;
+    }
+
+    const wchar_t *url = ((Js::JavascriptString*)(sourceUrl))->GetSz();
+    BYTE *buffer = context->GetRuntime()->MapSerializedFile(((Js::JavascriptString*)(path))->GetSz());
+    if (buffer == nullptr)
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    return RunSerializedScriptCore(
+        scriptLoadCallback, DummyScriptUnloadCallback,
+        sourceContext, // use the same user provided sourceContext as scriptLoadSourceContext
+        buffer, sourceContext, url, parseOnly, result, /* isBufferPinned */ true);
+}
+
+CHAKRA_API JsParseSerializedFile(
+    _In_ JsValueRef path,
+    _In_ JsSerializedLoadScriptCallback scriptLoadCallback,
+    _In_ JsSourceContext sourceContext,
+    _In_ JsValueRef sourceUrl,
+    _Out_ JsValueRef *result)
+{
+    return RunSerializedFileCore(path, scriptLoadCallback, sourceContext, sourceUrl, true, result);
+}
+
+CHAKRA_API JsRunSerializedFile(
+    _In_ JsValueRef path,
+    _In_ JsSerializedLoadScriptCallback scriptLoadCallback,
+    _In_ JsSourceContext sourceContext,
+    _In_ JsValueRef sourceUrl,
+    _Out_ JsValueRef *result)
+{
+    return RunSerializedFileCore(path, scriptLoadCallback, sourceContext, sourceUrl, false, result);
+}
+
+static bool CHAKRA_CALLBACK ContextSnapshotLoadSourceCallback(JsSourceContext sourceContext,
+    _Out_ JsValueRef *value, _Out_ JsParseScriptAttributes *parseAttributes)
+{
+    // The runtime keeps the source for as long as the function bodies deserialized from the snapshot
+    JsrtRuntime::ContextSnapshot * snapshot = (JsrtRuntime::ContextSnapshot *)sourceContext;
+    Js::ScriptContext * scriptContext = JsrtContext::GetCurrent()->GetScriptContext();
+
+    *value = Js::JsrtExternalArrayBuffer::New(snapshot->source, snapshot->sourceSize,
+        nullptr, nullptr, scriptContext->GetLibrary()->GetArrayBufferType());
+    *parseAttributes = snapshot->parseAttributes;
+    return true;
+}
+
+CHAKRA_API JsCreateContextSnapshot(
+    _In_ JsValueRef script,
+    _In_ JsValueRef sourceUrl,
+    _In_ JsParseScriptAttributes parseAttributes)
+{
+    PARAM_NOT_NULL(script);
+    VALIDATE_JSREF(script);
+    PARAM_NOT_NULL(sourceUrl);
+
+    bool isExternalArray = Js::ExternalArrayBuffer::Is(script);
+    if ((!isExternalArray && !Js::JavascriptString::Is(script)) || !Js::JavascriptString::Is(sourceUrl))
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    JsrtContext * context = JsrtContext::GetCurrent();
+    if (context == nullptr)
+    {
+        return JsErrorNoCurrentContext;
+    }
+
+    JsrtRuntime * runtime = context->GetRuntime();
+    const wchar_t *url = ((Js::JavascriptString*)(sourceUrl))->GetSz();
+    if (runtime->FindContextSnapshot(url) != nullptr)
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    // Strings are always UTF16; array buffers are UTF8 unless the attributes say otherwise
+    const byte * source;
+    size_t sourceSize;
+    if (isExternalArray)
+    {
+        source = ((Js::ExternalArrayBuffer*)(script))->GetBuffer();
+        sourceSize = ((Js::ExternalArrayBuffer*)(script))->GetByteLength();
+    }
+    else
+    {
+        source = (const byte*)((Js::JavascriptString*)(script))->GetSz();
+        sourceSize = ((Js::JavascriptString*)(script))->GetLength() * sizeof(char16);
+        parseAttributes = (JsParseScriptAttributes)(parseAttributes | JsParseScriptAttributeArrayBufferIsUtf16Encoded);
+    }
+    const bool isUtf8 = !(parseAttributes & JsParseScriptAttributeArrayBufferIsUtf16Encoded);
+
+    if (sourceSize > UINT_MAX - sizeof(char16))
+    {
+        return JsErrorOutOfMemory;
+    }
+
+    JsrtRuntime::ContextSnapshot * snapshot = HeapNewNoThrowStruct(JsrtRuntime::ContextSnapshot);
+    if (snapshot == nullptr)
+    {
+        return JsErrorOutOfMemory;
+    }
+
+    snapshot->urlLength = wcslen(url);
+    snapshot->url = HeapNewNoThrowArray(char16, snapshot->urlLength + 1);
+    snapshot->buffer = nullptr;
+    snapshot->bufferSize = 0;
+    snapshot->sourceSize = static_cast<unsigned int>(sourceSize);
+    // Terminated, since a UTF16 source is converted to UTF8 up to its terminator when it is loaded again
+    snapshot->source = HeapNewNoThrowArrayZ(byte, snapshot->sourceSize + sizeof(char16));
+    snapshot->parseAttributes = parseAttributes;
+    snapshot->next = nullptr;
+    if (snapshot->url == nullptr || snapshot->source == nullptr)
+    {
+        JsrtRuntime::DeleteContextSnapshot(snapshot);
+        return JsErrorOutOfMemory;
+    }
+
+    js_memcpy_s(snapshot->url, (snapshot->urlLength + 1) * sizeof(char16), url, (snapshot->urlLength + 1) * sizeof(char16));
+    js_memcpy_s(snapshot->source, snapshot->sourceSize, source, sourceSize);
+
+    // Compile from the runtime's copy; the caller's buffer does not have to outlive the call
+    LoadScriptFlag scriptFlag = isUtf8 ? LoadScriptFlag_Utf8Source : LoadScriptFlag_None;
+    JsErrorCode errorCode = JsSerializeScriptCore(snapshot->source, snapshot->sourceSize, scriptFlag,
+        nullptr, 0, nullptr, &snapshot->bufferSize, nullptr);
+    if (errorCode == JsNoError)
+    {
+        snapshot->buffer = HeapNewNoThrowArray(byte, snapshot->bufferSize);
+        errorCode = snapshot->buffer == nullptr ? JsErrorOutOfMemory :
+            JsSerializeScriptCore(snapshot->source, snapshot->sourceSize, scriptFlag,
+                nullptr, 0, snapshot->buffer, &snapshot->bufferSize, nullptr);
+    }
+
+    if (errorCode != JsNoError)
+    {
+        JsrtRuntime::DeleteContextSnapshot(snapshot);
+        return errorCode;
+    }
+
+    if (!runtime->AddContextSnapshot(snapshot))
+    {
+        JsrtRuntime::DeleteContextSnapshot(snapshot);
+        return JsErrorInvalidArgument;
+    }
+    return JsNoError;
+}
+
+CHAKRA_API JsRunContextSnapshot(
+    _In_ JsValueRef sourceUrl,
+    _Out_opt_ JsValueRef *result)
+{
+    PARAM_NOT_NULL(sourceUrl);
+
+    if (!Js::JavascriptString::Is(sourceUrl))
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    JsrtContext * context = JsrtContext::GetCurrent();
+    if (context == nullptr)
+    {
+        return JsErrorNoCurrentContext;
+    }
+
+    const wchar_t *url = ((Js::JavascriptString*)(sourceUrl))->GetSz();
+    JsrtRuntime::ContextSnapshot * snapshot = context->GetRuntime()->FindContextSnapshot(url);
+    if (snapshot == nullptr)
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    return RunSerializedScriptCore(
+        ContextSnapshotLoadSourceCallback, DummyScriptUnloadCallback,
+        (JsSourceContext)snapshot, // only used to find the source again
+        snapshot->buffer, JS_SOURCE_CONTEXT_NONE, snapshot->url, false, result, /* isBufferPinned */ true);
+}
+
+CHAKRA_API JsSetRuntimeGCPauseBudget(_In_ JsRuntimeHandle runtimeHandle, _In_ unsigned int microseconds)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+
+        if (threadContext->GetRecycler() && threadContext->GetRecycler()->IsHeapEnumInProgress())
+        {
+            return JsErrorHeapEnumInProgress;
+        }
+        else if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+#if ENABLE_CONCURRENT_GC
+        threadContext->EnsureRecycler()->SetIncrementalMarkBudget(microseconds);
+#endif
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsSerializeProfile(_In_ JsSourceContext sourceContext,
+    _Out_writes_to_opt_(*bufferSize, *bufferSize) BYTE *buffer,
+    _Inout_ unsigned int *bufferSize)
+{
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        PARAM_NOT_NULL(bufferSize);
+
+        if (*bufferSize > 0)
+        {
+            PARAM_NOT_NULL(buffer);
+        }
+
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+        if (sourceContext == JS_SOURCE_CONTEXT_NONE)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        SourceContextInfo * sourceContextInfo = scriptContext->GetSourceContextInfo(sourceContext, nullptr);
+        if (sourceContextInfo == nullptr)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        // We cast buffer size to DWORD* because on Windows, DWORD = unsigned long = unsigned int
+        // On 64-bit clang on linux, this is not true, unsigned long is larger than unsigned int
+        // However, the PAL defines DWORD for us on linux as unsigned int so the cast is safe here.
+        HRESULT hr = Js::SourceDynamicProfileManager::SerializeToBuffer(scriptContext, sourceContextInfo,
+            *bufferSize > 0 ? buffer : nullptr, (DWORD*)bufferSize);
+        if (SUCCEEDED(hr))
+        {
+            return JsNoError;
+        }
+        return hr == E_OUTOFMEMORY ? JsErrorOutOfMemory : JsErrorInvalidArgument;
+#else
+        return JsErrorInvalidArgument;
+#endif
+    });
+}
+
+CHAKRA_API JsLoadProfile(_In_ JsSourceContext sourceContext,
+    _In_reads_bytes_(bufferSize) const BYTE *buffer,
+    _In_ unsigned int bufferSize)
+{
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        PARAM_NOT_NULL(buffer);
+
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+        if (sourceContext == JS_SOURCE_CONTEXT_NONE || scriptContext->IsScriptContextInDebugMode())
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        // The profile is matched to the functions as they are parsed, so it has to be there before the first script
+        if (scriptContext->GetSourceContextInfo(sourceContext, nullptr) != nullptr)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::SourceDynamicProfileManager * profileManager =
+            Js::SourceDynamicProfileManager::DeserializeFromBuffer(buffer, bufferSize, scriptContext->GetRecycler());
+        if (profileManager == nullptr)
+        {
+            return JsErrorBadSerializedScript;
+        }
+
+        scriptContext->SetLoadedProfileManager(sourceContext, profileManager);
+        return JsNoError;
+#else
+        return JsErrorBadSerializedScript;
+#endif
+    });
+}
 #endif // NTBUILD
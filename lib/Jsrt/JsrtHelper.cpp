@@ -113,6 +113,12 @@ void JsrtCallbackState::ObjectBeforeCallectCallbackWrapper(JsObjectBeforeCollect
         ThreadBoundThreadContextManager::DestroyContextAndEntryForCurrentThread();
 
         JsrtRuntime::Uninitialize();
+#if ENABLE_NATIVE_CODEGEN
+        PageAllocatorPool::Shutdown();
+#endif
+#if ENABLE_JIT_WARMUP_CACHE
+        Js::JitWarmupCache::Shutdown();
+#endif
 
         // thread-bound entrypoint should be able to get cleanup correctly, however tlsentry
         // for current thread might be left behind if this thread was initialized.
@@ -146,6 +152,9 @@ void JsrtCallbackState::ObjectBeforeCallectCallbackWrapper(JsObjectBeforeCollect
     #endif
         ValueType::Initialize();
         ThreadContext::GlobalInitialize();
+    #if ENABLE_NATIVE_CODEGEN
+        PageAllocatorPool::Initialize();
+    #endif
 
         // Needed to make sure that only ChakraCore is loaded into the process
         // This is unnecessary on Linux since there aren't other flavors of
@@ -7,6 +7,7 @@
 #include "jsrtHelper.h"
 #include "Base/ThreadContextTlsEntry.h"
 #include "Base/ThreadBoundThreadContextManager.h"
+#include "ByteCode/ByteCodeSerializer.h"
 JsrtRuntime::JsrtRuntime(ThreadContext * threadContext, bool useIdle, bool dispatchExceptions)
 {
     Assert(threadContext != NULL);
@@ -28,6 +29,8 @@ JsrtRuntime::JsrtRuntime(ThreadContext * threadContext, bool useIdle, bool dispa
     serializeByteCodeForLibrary = false;
 #endif
     this->jsrtDebugManager = nullptr;
+    this->mappedSerializedFiles = nullptr;
+    this->contextSnapshots = nullptr;
 }
 
 JsrtRuntime::~JsrtRuntime()
@@ -38,6 +41,23 @@ JsrtRuntime::~JsrtRuntime()
         HeapDelete(this->jsrtDebugManager);
         this->jsrtDebugManager = nullptr;
     }
+
+    // Function bodies and strings deserialized from the views are gone with the thread context
+    while (this->mappedSerializedFiles != nullptr)
+    {
+        MappedSerializedFile * file = this->mappedSerializedFiles;
+        this->mappedSerializedFiles = file->next;
+        UnmapViewOfFile(file->view);
+        HeapDelete(file);
+    }
+
+    // Same for the snapshot buffers, which are deserialized in place as well
+    while (this->contextSnapshots != nullptr)
+    {
+        ContextSnapshot * snapshot = this->contextSnapshots;
+        this->contextSnapshots = snapshot->next;
+        DeleteContextSnapshot(snapshot);
+    }
 }
 
 // This is called at process detach.
@@ -63,6 +83,126 @@ void JsrtRuntime::Uninitialize()
     }
 }
 
+byte * JsrtRuntime::MapSerializedFile(const char16 * path)
+{
+    HANDLE fileHandle = CreateFileW(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        return nullptr;
+    }
+
+    // Views are looked up by the identity of the file rather than by its path, so a file replaced at the same path is
+    // mapped again instead of running the byte code of the file it replaced
+    BY_HANDLE_FILE_INFORMATION fileInformation;
+    if (!GetFileInformationByHandle(fileHandle, &fileInformation))
+    {
+        CloseHandle(fileHandle);
+        return nullptr;
+    }
+
+    const uint64 fileSize = ((uint64)fileInformation.nFileSizeHigh << 32) | fileInformation.nFileSizeLow;
+    for (MappedSerializedFile * file = this->mappedSerializedFiles; file != nullptr; file = file->next)
+    {
+        if (file->volumeSerialNumber == fileInformation.dwVolumeSerialNumber &&
+            file->fileIndexHigh == fileInformation.nFileIndexHigh &&
+            file->fileIndexLow == fileInformation.nFileIndexLow &&
+            file->lastWriteTime.dwHighDateTime == fileInformation.ftLastWriteTime.dwHighDateTime &&
+            file->lastWriteTime.dwLowDateTime == fileInformation.ftLastWriteTime.dwLowDateTime &&
+            file->viewSize == fileSize)
+        {
+            CloseHandle(fileHandle);
+            return file->view;
+        }
+    }
+
+    if (fileSize == 0 || fileSize > UINT32_MAX)
+    {
+        CloseHandle(fileHandle);
+        return nullptr;
+    }
+
+    // Serialized byte code is never written to, so the pages stay shared with the file cache
+    HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(fileHandle);
+    if (mappingHandle == nullptr)
+    {
+        return nullptr;
+    }
+
+    byte * view = (byte *)MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mappingHandle);
+    if (view == nullptr)
+    {
+        return nullptr;
+    }
+
+    // A truncated or foreign file must not be read past the end of the view
+    const size_t viewSize = (size_t)fileSize;
+    if (!Js::ByteCodeSerializer::IsCompleteBuffer(view, viewSize))
+    {
+        UnmapViewOfFile(view);
+        return nullptr;
+    }
+
+    MappedSerializedFile * file = HeapNewNoThrowStruct(MappedSerializedFile);
+    if (file == nullptr)
+    {
+        UnmapViewOfFile(view);
+        return nullptr;
+    }
+
+    file->volumeSerialNumber = fileInformation.dwVolumeSerialNumber;
+    file->fileIndexHigh = fileInformation.nFileIndexHigh;
+    file->fileIndexLow = fileInformation.nFileIndexLow;
+    file->lastWriteTime = fileInformation.ftLastWriteTime;
+    file->view = view;
+    file->viewSize = viewSize;
+    file->next = this->mappedSerializedFiles;
+    this->mappedSerializedFiles = file;
+    return view;
+}
+
+bool JsrtRuntime::AddContextSnapshot(ContextSnapshot * snapshot)
+{
+    if (FindContextSnapshot(snapshot->url) != nullptr)
+    {
+        return false;
+    }
+
+    snapshot->next = this->contextSnapshots;
+    this->contextSnapshots = snapshot;
+    return true;
+}
+
+JsrtRuntime::ContextSnapshot * JsrtRuntime::FindContextSnapshot(const char16 * url)
+{
+    for (ContextSnapshot * snapshot = this->contextSnapshots; snapshot != nullptr; snapshot = snapshot->next)
+    {
+        if (wcscmp(snapshot->url, url) == 0)
+        {
+            return snapshot;
+        }
+    }
+    return nullptr;
+}
+
+void JsrtRuntime::DeleteContextSnapshot(ContextSnapshot * snapshot)
+{
+    if (snapshot->url != nullptr)
+    {
+        HeapDeleteArray(snapshot->urlLength + 1, snapshot->url);
+    }
+    if (snapshot->buffer != nullptr)
+    {
+        HeapDeleteArray(snapshot->bufferSize, snapshot->buffer);
+    }
+    if (snapshot->source != nullptr)
+    {
+        HeapDeleteArray(snapshot->sourceSize + sizeof(char16), snapshot->source);
+    }
+    HeapDelete(snapshot);
+}
+
 void JsrtRuntime::CloseContexts()
 {
     while (this->contextList != NULL)
@@ -46,9 +46,45 @@ public:
     void DeleteJsrtDebugManager();
     JsrtDebugManager * GetJsrtDebugManager();
 
+    // Maps a serialized script file read-only, or returns the view already mapped for the same file.
+    // Returns nullptr if the file does not hold a complete serialized buffer. The view stays mapped
+    // until the runtime is disposed.
+    byte * MapSerializedFile(const char16 * path);
+
+    // A bootstrap script compiled once for the runtime. Contexts created later run its byte code
+    // instead of parsing the script again.
+    struct ContextSnapshot
+    {
+        char16 * url;
+        size_t urlLength;
+        byte * buffer;
+        unsigned int bufferSize;
+        byte * source;
+        unsigned int sourceSize;
+        JsParseScriptAttributes parseAttributes;
+        ContextSnapshot * next;
+    };
+
+    // The runtime owns the snapshot, and the buffers it points to, until it is disposed.
+    // Returns false if a snapshot was already added for the same url.
+    bool AddContextSnapshot(ContextSnapshot * snapshot);
+    ContextSnapshot * FindContextSnapshot(const char16 * url);
+    static void DeleteContextSnapshot(ContextSnapshot * snapshot);
+
 private:
     static void __cdecl RecyclerCollectCallbackStatic(void * context, RecyclerCollectCallBackFlags flags);
 
+    struct MappedSerializedFile
+    {
+        DWORD volumeSerialNumber;
+        DWORD fileIndexHigh;
+        DWORD fileIndexLow;
+        FILETIME lastWriteTime;
+        byte * view;
+        size_t viewSize;
+        MappedSerializedFile * next;
+    };
+
 private:
     ThreadContext * threadContext;
     AllocationPolicyManager* allocationPolicyManager;
@@ -63,4 +99,6 @@ private:
     bool serializeByteCodeForLibrary;
 #endif
     JsrtDebugManager * jsrtDebugManager;
+    MappedSerializedFile * mappedSerializedFiles;
+    ContextSnapshot * contextSnapshots;
 };
@@ -29,6 +29,21 @@ unsigned int JsrtThreadService::Idle()
 {
     unsigned int currentTicks = GetTickCount();
 
+#if ENABLE_CONCURRENT_GC
+    // With incremental mark on, each idle call runs one mark slice, and the call after the marking is done
+    // finishes the collection. Ask the host to come back right away while there is work left for this thread.
+    Recycler * recycler = GetThreadContext()->GetRecycler();
+    if (recycler != nullptr && recycler->GetIncrementalMarkBudget() != 0
+        && recycler->CollectionInProgress() && !recycler->IsConcurrentExecutingState())
+    {
+        recycler->FinishConcurrent<FinishConcurrentOnIdle>();
+        if (recycler->CollectionInProgress() && !recycler->IsConcurrentExecutingState())
+        {
+            return currentTicks;
+        }
+    }
+#endif
+
     if (currentTicks >= nextIdleTick)
     {
         IdleCollect();
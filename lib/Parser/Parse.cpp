@@ -1133,6 +1133,105 @@ ParseNodePtr Parser::CreateBinNode(OpCode nop, ParseNodePtr pnode1, ParseNodePtr
     return CreateBinNode(nop, pnode1, pnode2, ichMin, ichLim);
 }
 
+// Fold an arithmetic or bitwise operator applied to two number literals into a single number literal, so the
+// byte code loads one constant instead of computing the same value each time the expression runs.
+// Returns nullptr if the expression can't be folded.
+ParseNodePtr Parser::TryFoldNumericBinNode(OpCode nop, ParseNodePtr pnode1, ParseNodePtr pnode2)
+{
+    // Asm.js validation depends on the shape of the literals in the source, and the debugger steps through the
+    // expressions as written
+    if (m_InAsmMode || m_scriptContext->IsScriptContextInDebugMode() || PHASE_OFF1(Js::ByteCodeConstFoldPhase) ||
+        (pnode1->nop != knopInt && pnode1->nop != knopFlt) ||
+        (pnode2->nop != knopInt && pnode2->nop != knopFlt))
+    {
+        return nullptr;
+    }
+
+    const bool isIntPair = pnode1->nop == knopInt && pnode2->nop == knopInt;
+    const double left = pnode1->nop == knopInt ? pnode1->sxInt.lw : pnode1->sxFlt.dbl;
+    const double right = pnode2->nop == knopInt ? pnode2->sxInt.lw : pnode2->sxFlt.dbl;
+    double result;
+    switch (nop)
+    {
+    case knopAdd:
+        result = left + right;
+        break;
+    case knopSub:
+        result = left - right;
+        break;
+    case knopMul:
+        result = left * right;
+        break;
+    case knopDiv:
+        result = left / right;
+        break;
+
+    // Bitwise operators are only folded on int literals, which need no ToInt32 conversion
+    case knopOr:
+    case knopXor:
+    case knopAnd:
+    case knopLsh:
+    case knopRsh:
+    case knopRs2:
+    {
+        if (!isIntPair)
+        {
+            return nullptr;
+        }
+        const int32 leftInt = pnode1->sxInt.lw;
+        const uint32 rightInt = (uint32)pnode2->sxInt.lw;
+        switch (nop)
+        {
+        case knopOr:
+            result = leftInt | (int32)rightInt;
+            break;
+        case knopXor:
+            result = leftInt ^ (int32)rightInt;
+            break;
+        case knopAnd:
+            result = leftInt & (int32)rightInt;
+            break;
+        case knopLsh:
+            result = (int32)((uint32)leftInt << (rightInt & 0x1F));
+            break;
+        case knopRsh:
+            result = leftInt >> (rightInt & 0x1F);
+            break;
+        default:
+            Assert(nop == knopRs2);
+            result = (uint32)leftInt >> (rightInt & 0x1F);
+            break;
+        }
+        break;
+    }
+
+    default:
+        return nullptr;
+    }
+
+    // Number constants are looked up by value when byte code registers are assigned, which can't tell -0
+    // from 0 and never finds NaN, so leave those to run time.
+    if (Js::NumberUtilities::IsNan(result) || Js::JavascriptNumber::IsNegZero(result))
+    {
+        return nullptr;
+    }
+
+    ParseNodePtr pnode;
+    int32 intResult;
+    if (Js::JavascriptNumber::TryGetInt32Value(result, &intResult))
+    {
+        pnode = CreateNodeT<knopInt>(pnode1->ichMin, pnode2->ichLim);
+        pnode->sxInt.lw = intResult;
+    }
+    else
+    {
+        pnode = CreateNodeT<knopFlt>(pnode1->ichMin, pnode2->ichLim);
+        pnode->sxFlt.dbl = result;
+        pnode->sxFlt.maybeInt = false;
+    }
+    return pnode;
+}
+
 ParseNodePtr Parser::CreateTriNode(OpCode nop, ParseNodePtr pnode1,
                                    ParseNodePtr pnode2, ParseNodePtr pnode3)
 {
@@ -8416,25 +8515,33 @@ ParseNodePtr Parser::ParseExpr(int oplMin,
 
             if (buildAST)
             {
-                pnode = CreateBinNode(nop, pnode, pnodeT);
-                Assert(pnode->sxBin.pnode2 != NULL);
-                if (pnode->sxBin.pnode2->nop == knopFncDecl)
+                ParseNodePtr pnodeFolded = TryFoldNumericBinNode(nop, pnode, pnodeT);
+                if (pnodeFolded != nullptr)
+                {
+                    pnode = pnodeFolded;
+                }
+                else
                 {
-                    Assert(hintLength >= hintOffset);
-                    pnode->sxBin.pnode2->sxFnc.hint = pNameHint;
-                    pnode->sxBin.pnode2->sxFnc.hintLength = hintLength;
-                    pnode->sxBin.pnode2->sxFnc.hintOffset = hintOffset;
+                    pnode = CreateBinNode(nop, pnode, pnodeT);
+                    Assert(pnode->sxBin.pnode2 != NULL);
+                    if (pnode->sxBin.pnode2->nop == knopFncDecl)
+                    {
+                        Assert(hintLength >= hintOffset);
+                        pnode->sxBin.pnode2->sxFnc.hint = pNameHint;
+                        pnode->sxBin.pnode2->sxFnc.hintLength = hintLength;
+                        pnode->sxBin.pnode2->sxFnc.hintOffset = hintOffset;
 
-                    if (pnode->sxBin.pnode1->nop == knopDot)
+                        if (pnode->sxBin.pnode1->nop == knopDot)
+                        {
+                            pnode->sxBin.pnode2->sxFnc.isNameIdentifierRef  = false;
+                        }
+                    }
+                    if (pnode->sxBin.pnode2->nop == knopClassDecl && pnode->sxBin.pnode1->nop == knopDot)
                     {
-                        pnode->sxBin.pnode2->sxFnc.isNameIdentifierRef  = false;
+                        Assert(pnode->sxBin.pnode2->sxClass.pnodeConstructor);
+                        pnode->sxBin.pnode2->sxClass.pnodeConstructor->sxFnc.isNameIdentifierRef  = false;
                     }
                 }
-                if (pnode->sxBin.pnode2->nop == knopClassDecl && pnode->sxBin.pnode1->nop == knopDot)
-                {
-                    Assert(pnode->sxBin.pnode2->sxClass.pnodeConstructor);
-                    pnode->sxBin.pnode2->sxClass.pnodeConstructor->sxFnc.isNameIdentifierRef  = false;
-                }
             }
             pNameHint = NULL;
         }
@@ -289,6 +289,7 @@ public:
     ParseNodePtr CreateUniNode(OpCode nop, ParseNodePtr pnodeOp);
     ParseNodePtr CreateBinNode(OpCode nop, ParseNodePtr pnode1, ParseNodePtr pnode2);
     ParseNodePtr CreateCallNode(OpCode nop, ParseNodePtr pnode1, ParseNodePtr pnode2);
+    ParseNodePtr TryFoldNumericBinNode(OpCode nop, ParseNodePtr pnode1, ParseNodePtr pnode2);
 
     // Create parse node with token limis
     template <OpCode nop>
@@ -2254,7 +2254,16 @@ namespace Js
                 BEGIN_TRANSLATE_EXCEPTION_TO_HRESULT
                 {
                     CompileScriptException se;
-                    Parser ps(m_scriptContext, funcBody->GetIsStrictMode() ? TRUE : FALSE);
+                    PageAllocator * parsePageAllocator = nullptr;
+#if ENABLE_NATIVE_CODEGEN
+                    // The parse tree only lives for this function, keep its pages warm in the process-wide pool
+                    AutoReturnPageAllocator autoReturnPageAllocator;
+                    if (PageAllocatorPool::CanUseForPolicy(m_scriptContext->GetThreadContext()->GetAllocationPolicyManager()))
+                    {
+                        parsePageAllocator = autoReturnPageAllocator.GetPageAllocator();
+                    }
+#endif
+                    Parser ps(m_scriptContext, funcBody->GetIsStrictMode() ? TRUE : FALSE, parsePageAllocator);
                     ParseNodePtr parseTree;
 
                     uint nextFunctionId = funcBody->GetLocalFunctionId();
@@ -4093,7 +4102,7 @@ namespace Js
         this->RecordConstant(location, intConst);
     }
 
-    void FunctionBody::RecordStrConstant(RegSlot location, LPCOLESTR psz, uint32 cch)
+    void FunctionBody::RecordStrConstant(RegSlot location, LPCOLESTR psz, uint32 cch, bool copyBuffer)
     {
         ScriptContext *scriptContext = this->GetScriptContext();
         PropertyRecord const * propertyRecord;
@@ -4101,7 +4110,10 @@ namespace Js
         Var str;
         if (propertyRecord == nullptr)
         {
-            str = JavascriptString::NewCopyBuffer(psz, cch, scriptContext);
+            // Without a copy, the caller guarantees that the buffer outlives the script context
+            str = copyBuffer ?
+                JavascriptString::NewCopyBuffer(psz, cch, scriptContext) :
+                JavascriptString::NewWithArenaBuffer(psz, cch, scriptContext);
         }
         else
         {
@@ -6882,6 +6894,22 @@ namespace Js
         SetExecutionMode(GetDefaultInterpreterExecutionMode());
         SetFullJitThreshold(fullJitThreshold);
         TryTransitionToNextInterpreterExecutionMode();
+
+#if ENABLE_JIT_WARMUP_CACHE
+        if(!configFlags.EnforceExecutionModeLimits &&
+            doInterpreterProfile &&
+            !PHASE_OFF(FullJitPhase, this) &&
+            this->fullJitThreshold > GetMinProfileIterations() &&
+            JitWarmupCache::ShouldFastTrack(this))
+        {
+            // This function reached full JIT with the same profile in earlier runs. Only profile it for the minimum number of
+            // iterations, starting right away, and skip simple JIT.
+            TraceExecutionMode("JitWarmupCache (before)");
+            SetFullJitThreshold(GetMinProfileIterations(), true);
+            SetIsSpeculativeJitCandidate();
+            TraceExecutionMode("JitWarmupCache");
+        }
+#endif
     }
 
     void FunctionBody::ReinitializeExecutionModeAndLimits()
@@ -6966,7 +6994,7 @@ namespace Js
         {
             Assert(IsInterpreterExecutionMode());
             if(simpleJitLimit != 0 &&
-                (skipSimpleJit || simpleJitLimit < DEFAULT_CONFIG_MinSimpleJitIterations) &&
+                (skipSimpleJit || simpleJitLimit < static_cast<uint>(CONFIG_FLAG_RELEASE(MinSimpleJitIterations))) &&
                 !PHASE_FORCE(Phase::SimpleJitPhase, this))
             {
                 // Simple JIT code has not yet been generated, and was either requested to be skipped, or the limit was scaled
@@ -7148,6 +7176,69 @@ namespace Js
         fullJitRequeueThreshold = static_cast<uint16>(DEFAULT_CONFIG_FullJitRequeueThreshold);
     }
 
+    bool FunctionBody::AdaptTierUpToJitQueue(const uint queuedFullJitWorkItemCount)
+    {
+        Assert(initializedExecutionModeAndLimits);
+        Assert(CONFIG_FLAG_RELEASE(AdaptiveTierUp));
+
+        if(Configuration::Global.flags.EnforceExecutionModeLimits)
+        {
+            return true;
+        }
+
+        // Hot: a loop in the function was hot enough to be jitted, or the function is called from a loop. Unstable: jitted code
+        // for the function already bailed out enough to be rejitted, so more profiling is likely to pay off.
+        const bool isHot = GetHasHotLoop() || WasCalledFromLoop();
+        const bool isUnstable =
+            RecentlyBailedOutOfJittedLoopBody() ||
+            (HasDynamicProfileInfo() && GetAnyDynamicProfileInfo()->GetRejitCount() != 0);
+        const uint jitQueueThreshold = max(1u, static_cast<uint>(CONFIG_FLAG(JitQueueThreshold)));
+
+        switch(GetExecutionMode())
+        {
+            case ExecutionMode::SimpleJit:
+            {
+                // The full JIT has nothing to do. Spend less time in simple JIT code for a hot function with a stable profile
+                // so that it reaches the full JIT sooner.
+                const uint16 minSimpleJitLimit = static_cast<uint16>(CONFIG_FLAG_RELEASE(MinSimpleJitIterations));
+                if(queuedFullJitWorkItemCount != 0 || !isHot || isUnstable || simpleJitLimit <= minSimpleJitLimit * 2)
+                {
+                    return true;
+                }
+
+                TraceExecutionMode("AdaptiveTierUp (before)");
+                SetFullJitThreshold(fullJitThreshold - simpleJitLimit / 2);
+                TraceExecutionMode("AdaptiveTierUp");
+                return true;
+            }
+
+            case ExecutionMode::FullJit:
+            {
+                if(queuedFullJitWorkItemCount < jitQueueThreshold || isHot)
+                {
+                    return true;
+                }
+
+                // The full JIT queue is full, and queuing this function would displace an older work item. Wait for the
+                // function to be called some more before queuing it instead, longer the more the queue is backed up and
+                // longer still if its jitted code has been bailing out. Cold functions will not make it back to the queue.
+                uint requeueThreshold =
+                    static_cast<uint>(DEFAULT_CONFIG_FullJitRequeueThreshold) * queuedFullJitWorkItemCount / jitQueueThreshold;
+                if(isUnstable)
+                {
+                    requeueThreshold *= 2;
+                }
+                fullJitRequeueThreshold = static_cast<uint16>(min(requeueThreshold, static_cast<uint>(UINT16_MAX)));
+                TraceExecutionMode("AdaptiveTierUp (full JIT deferred)");
+                return false;
+            }
+
+            default:
+                Assert(false);
+                __assume(false);
+        }
+    }
+
     void FunctionBody::TraceExecutionMode(const char *const eventDescription) const
     {
         Assert(initializedExecutionModeAndLimits);
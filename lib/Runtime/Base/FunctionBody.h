@@ -2773,6 +2773,7 @@ namespace Js
 
     public:
         void OnFullJitDequeued(const FunctionEntryPointInfo *const entryPointInfo);
+        bool AdaptTierUpToJitQueue(const uint queuedFullJitWorkItemCount);
 
     public:
         void TraceExecutionMode(const char *const eventDescription = nullptr) const;
@@ -3283,7 +3284,7 @@ namespace Js
         void RecordTrueObject(RegSlot location);
         void RecordFalseObject(RegSlot location);
         void RecordIntConstant(RegSlot location, unsigned int val);
-        void RecordStrConstant(RegSlot location, LPCOLESTR psz, uint32 cch);
+        void RecordStrConstant(RegSlot location, LPCOLESTR psz, uint32 cch, bool copyBuffer = true);
         void RecordFloatConstant(RegSlot location, double d);
         void RecordNullDisplayConstant(RegSlot location);
         void RecordStrictNullDisplayConstant(RegSlot location);
@@ -253,6 +253,7 @@ namespace Js
         byteCodeAuxiliaryDataSize = 0;
         byteCodeAuxiliaryContextDataSize = 0;
         memset(byteCodeHistogram, 0, sizeof(byteCodeHistogram));
+        byteCodePairHistogram = nullptr;
 #endif
 
         memset(propertyStrings, 0, sizeof(PropertyStringMap*)* 80);
@@ -323,6 +324,13 @@ namespace Js
         }
 #endif
 
+#if DBG_DUMP
+        if (Configuration::Global.flags.BytecodePairHist)
+        {
+            byteCodePairHistogram = Anew(GeneralAllocator(), ByteCodePairHistogram, GeneralAllocator());
+        }
+#endif
+
 #ifdef ENABLE_BASIC_TELEMETRY
         this->telemetry = Anew(this->TelemetryAllocator(), ScriptContextTelemetry, *this);
 #endif
@@ -2383,7 +2391,19 @@ namespace Js
 #if ENABLE_PROFILE_INFO
         if (!this->startupComplete)
         {
-            sourceContextInfo->sourceDynamicProfileManager = SourceDynamicProfileManager::LoadFromDynamicProfileStorage(sourceContextInfo, this, profileDataCache);
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+            // A profile the host loaded ahead of the first script for this source context takes precedence
+            SourceDynamicProfileManager * loadedProfileManager = nullptr;
+            if (this->cache->loadedProfileManagerMap != nullptr &&
+                this->cache->loadedProfileManagerMap->TryGetValueAndRemove(sourceContext, &loadedProfileManager))
+            {
+                sourceContextInfo->sourceDynamicProfileManager = loadedProfileManager;
+            }
+            else
+#endif
+            {
+                sourceContextInfo->sourceDynamicProfileManager = SourceDynamicProfileManager::LoadFromDynamicProfileStorage(sourceContextInfo, this, profileDataCache);
+            }
             Assert(sourceContextInfo->sourceDynamicProfileManager != NULL);
         }
 
@@ -2392,6 +2412,21 @@ namespace Js
         return sourceContextInfo;
     }
 
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+    void ScriptContext::SetLoadedProfileManager(DWORD_PTR sourceContext, SourceDynamicProfileManager * profileManager)
+    {
+        Assert(sourceContext != Js::Constants::NoHostSourceContext);
+        Assert(profileManager != nullptr);
+        Assert(this->GetSourceContextInfo(sourceContext, nullptr) == nullptr);
+
+        if (this->cache->loadedProfileManagerMap == nullptr)
+        {
+            this->cache->loadedProfileManagerMap = RecyclerNew(this->GetRecycler(), LoadedProfileManagerMap, this->GetRecycler());
+        }
+        this->cache->loadedProfileManagerMap->Item(sourceContext, profileManager);
+    }
+#endif
+
     // static
     const char16* ScriptContext::CopyString(const char16* str, size_t charCount, ArenaAllocator* alloc)
     {
@@ -4949,6 +4984,21 @@ void ScriptContext::RegisterPrototypeChainEnsuredToHaveOnlyWritableDataPropertie
         dest.hash = TAGHASH((hash_t)dest.str);
     }
 
+#if DBG_DUMP
+    void ScriptContext::RecordByteCodePair(OpCode firstOp, OpCode secondOp)
+    {
+        if (byteCodePairHistogram == nullptr)
+        {
+            return;
+        }
+
+        const uint32 pair = ((uint32)firstOp << 16) | (uint32)secondOp;
+        uint count = 0;
+        byteCodePairHistogram->TryGetValue(pair, &count);
+        byteCodePairHistogram->Item(pair, count + 1);
+    }
+#endif
+
     void ScriptContext::PrintStats()
     {
 #if ENABLE_PROFILE_INFO
@@ -5068,6 +5118,54 @@ void ScriptContext::RegisterPrototypeChainEnsuredToHaveOnlyWritableDataPropertie
             Output::Print(_u("Unique opcodes: %d\n"), unique);
         }
 
+        if (byteCodePairHistogram != nullptr)
+        {
+            struct PairCount
+            {
+                uint32 pair;
+                uint count;
+
+                static int __cdecl CompareDescending(void *, const void * a, const void * b)
+                {
+                    const uint countA = ((const PairCount *)a)->count;
+                    const uint countB = ((const PairCount *)b)->count;
+                    return countA < countB ? 1 : (countA > countB ? -1 : 0);
+                }
+            };
+
+            JsUtil::List<PairCount, ArenaAllocator> pairCounts(GeneralAllocator());
+            uint total = 0;
+            byteCodePairHistogram->Map([&](uint32 pair, uint count)
+            {
+                const PairCount pairCount = { pair, count };
+                pairCounts.Add(pairCount);
+                total += count;
+            });
+            pairCounts.Sort(PairCount::CompareDescending, nullptr);
+
+            // Superinstruction candidates are at the top; the long tail is not interesting
+            const int maxPairsToPrint = 100;
+            Output::Print(_u("ByteCode Pair Histogram\n"));
+            Output::Print(_u("\n"));
+            Output::Print(_u("%9u                     Total executed pairs\n"), total);
+            Output::Print(_u("\n"));
+
+            double pctcume = 0.0;
+            for (int i = 0; i < pairCounts.Count() && i < maxPairsToPrint; i++)
+            {
+                const PairCount& pairCount = pairCounts.Item(i);
+                const OpCode firstOp = (OpCode)(pairCount.pair >> 16);
+                const OpCode secondOp = (OpCode)(pairCount.pair & 0xFFFF);
+                double pct = ((double)pairCount.count) / total;
+                pctcume += pct;
+
+                Output::Print(_u("%9u  %5.1lf  %5.1lf  %s, %s\n"), pairCount.count, pct * 100, pctcume * 100,
+                    OpCodeUtil::GetOpCodeName(firstOp), OpCodeUtil::GetOpCodeName(secondOp));
+            }
+            Output::Print(_u("\n"));
+            Output::Print(_u("Unique pairs: %d\n"), pairCounts.Count());
+        }
+
 #endif
 
 #if ENABLE_NATIVE_CODEGEN
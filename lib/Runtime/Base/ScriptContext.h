@@ -321,6 +321,9 @@ namespace Js
     static const unsigned int EvalMRUSize = 15;
     typedef JsUtil::BaseDictionary<DWORD_PTR, SourceContextInfo *, Recycler, PowerOf2SizePolicy> SourceContextInfoMap;
     typedef JsUtil::BaseDictionary<uint, SourceContextInfo *, Recycler, PowerOf2SizePolicy> DynamicSourceContextInfoMap;
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+    typedef JsUtil::BaseDictionary<DWORD_PTR, SourceDynamicProfileManager *, Recycler, PowerOf2SizePolicy> LoadedProfileManagerMap;
+#endif
 
     typedef JsUtil::BaseDictionary<EvalMapString, ScriptFunction*, RecyclerNonLeafAllocator, PrimeSizePolicy> SecondLevelEvalCache;
     typedef TwoLevelHashRecord<FastEvalMapString, ScriptFunction*, SecondLevelEvalCache, EvalMapString> EvalMapRecord;
@@ -371,6 +374,9 @@ namespace Js
         RegexPatternMruMap *dynamicRegexMap;
         SourceContextInfoMap* sourceContextInfoMap;   // maps host provided context cookie to the URL of the script buffer passed.
         DynamicSourceContextInfoMap* dynamicSourceContextInfoMap;
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+        LoadedProfileManagerMap* loadedProfileManagerMap; // profiles loaded by the host for source contexts that haven't been created yet
+#endif
         SourceContextInfo* noContextSourceContextInfo;
         SRCINFO* noContextGlobalSourceInfo;
         SRCINFO const ** moduleSrcInfo;
@@ -624,6 +630,10 @@ public:
         uint byteCodeAuxiliaryDataSize;
         uint byteCodeAuxiliaryContextDataSize;
         uint byteCodeHistogram[static_cast<uint>(OpCode::ByteCodeLast)];
+        // Executed counts of consecutive opcode pairs, keyed by (first << 16) | second
+        typedef JsUtil::BaseDictionary<uint32, uint, ArenaAllocator> ByteCodePairHistogram;
+        ByteCodePairHistogram * byteCodePairHistogram;
+        void RecordByteCodePair(OpCode firstOp, OpCode secondOp);
         uint32 forinCache;
         uint32 forinNoCache;
 #endif
@@ -1036,6 +1046,9 @@ private:
         SourceContextInfo * CreateSourceContextInfo(uint hash, DWORD_PTR hostSourceContext);
         SourceContextInfo * CreateSourceContextInfo(DWORD_PTR hostSourceContext, char16 const * url, size_t len,
             IActiveScriptDataCache* profileDataCache, char16 const * sourceMapUrl = nullptr, size_t sourceMapUrlLen = 0);
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+        void SetLoadedProfileManager(DWORD_PTR hostSourceContext, SourceDynamicProfileManager * profileManager);
+#endif
 
 #if defined(LEAK_REPORT) || defined(CHECK_MEMORY_LEAK)
         void ClearSourceContextInfoMaps()
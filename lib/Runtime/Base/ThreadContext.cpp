@@ -742,6 +742,11 @@ Recycler* ThreadContext::EnsureRecycler()
     if (recycler == NULL)
     {
         AutoRecyclerPtr newRecycler(HeapNew(Recycler, GetAllocationPolicyManager(), &pageAllocator, Js::Throw::OutOfMemory, Js::Configuration::Global.flags));
+        if (this->TestThreadContextFlag(ThreadContextFlagNumaAffinity))
+        {
+            // Keep the heap on the node of the thread that first needs it
+            newRecycler->SetNumaNode(AutoSystemInfo::GetCurrentNumaNode());
+        }
         newRecycler->Initialize(isOptimizedForManyInstances, &threadService); // use in-thread GC when optimizing for many instances
         newRecycler->SetCollectionWrapper(this);
 
@@ -37,6 +37,9 @@ namespace Js
         debugModeSourceLength(0),
         m_isInDebugMode(false),
         callerUtf8SourceInfo(nullptr)
+#if ENABLE_JIT_WARMUP_CACHE
+        ,jitWarmupRecord(nullptr)
+#endif
 #ifndef NTBUILD
         ,sourceRef(scriptSource)
 #endif
@@ -6,6 +6,10 @@
 
 namespace Js
 {
+#if ENABLE_JIT_WARMUP_CACHE
+    class JitWarmupSourceRecord;
+#endif
+
     struct Utf8SourceInfo : public FinalizableObject
     {
         typedef JsUtil::LeafValueDictionary<Js::LocalFunctionId, Js::FunctionBody*>::Type FunctionBodyDictionary;
@@ -253,6 +257,12 @@ namespace Js
 
         bool IsHostManagedSource() const;
 
+#if ENABLE_JIT_WARMUP_CACHE
+        // Owned by JitWarmupCache, only accessed under its lock
+        JitWarmupSourceRecord * GetJitWarmupRecord() const { return jitWarmupRecord; }
+        void SetJitWarmupRecord(JitWarmupSourceRecord * record) { jitWarmupRecord = record; }
+#endif
+
         static int StaticGetHashCode(__in const Utf8SourceInfo* const si)
         {
             return si->GetSourceHolder()->GetHashCode();
@@ -378,6 +388,10 @@ namespace Js
         // Utf8SourceInfo of the caller, used for mapping eval/new Function node to its caller node for debugger
         Utf8SourceInfo* callerUtf8SourceInfo;
 
+#if ENABLE_JIT_WARMUP_CACHE
+        JitWarmupSourceRecord* jitWarmupRecord;
+#endif
+
         bool m_deferredFunctionsInitialized : 1;
         bool m_isCesu8 : 1;
         bool m_hasHostBuffer : 1;
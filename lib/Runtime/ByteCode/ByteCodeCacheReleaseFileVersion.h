@@ -4,6 +4,6 @@
 //-------------------------------------------------------------------------------------------------------
 // NOTE: If there is a merge conflict the correct fix is to make a new GUID.
 
-// {771a842c-80af-49ed-881c-1890d339426c}
+// {aa44ec4f-f01c-4cb8-b39b-cc0145d81b56}
 const GUID byteCodeCacheReleaseFileVersion =
-{ 0x771a842c, 0x80af, 0x49ed, { 0x88, 0x1c, 0x18, 0x90, 0xd3, 0x39, 0x42, 0x6c } };
+{ 0xaa44ec4f, 0xf01c, 0x4cb8, { 0xb3, 0x9b, 0xcc, 0x01, 0x45, 0xd8, 0x1b, 0x56 } };
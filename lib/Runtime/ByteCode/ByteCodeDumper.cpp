@@ -1002,6 +1002,7 @@ namespace Js
             case OpCode::LdFld:
             case OpCode::LdFldForCallApplyTarget:
             case OpCode::LdMethodFld:
+            case OpCode::LdMethodFldCallI:
             case OpCode::ScopedLdMethodFld:
             {
                 Output::Print(_u(" R%d = R%d.%s #%d"), data->Value, data->Instance,
@@ -1023,6 +1024,7 @@ namespace Js
             case OpCode::ProfiledLdFld:
             case OpCode::ProfiledLdFldForCallApplyTarget:
             case OpCode::ProfiledLdMethodFld:
+            case OpCode::ProfiledLdMethodFldCallI:
             {
                 Output::Print(_u(" R%d = R%d.%s #%d"), data->Value, data->Instance,
                         pPropertyName->GetBuffer(), data->inlineCacheIndex);
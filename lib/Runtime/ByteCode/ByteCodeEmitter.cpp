@@ -7698,7 +7698,8 @@ void EmitCallTarget(
     Js::RegSlot *thisLocation,
     Js::RegSlot *callObjLocation,
     ByteCodeGenerator *byteCodeGenerator,
-    FuncInfo *funcInfo)
+    FuncInfo *funcInfo,
+    bool fFuseMethodCall = false)
 {
     // - emit target
     //    - assign this
@@ -7737,7 +7738,16 @@ void EmitCallTarget(
             pnodeTarget->sxBin.pnode1->location;
 
         EmitSuperMethodBegin(pnodeTarget, byteCodeGenerator, funcInfo);
-        EmitMethodFld(pnodeTarget, protoLocation, propertyId, byteCodeGenerator, funcInfo);
+        if (fFuseMethodCall && protoLocation != funcInfo->frameObjRegister)
+        {
+            // The interpreter runs the StartCall, ArgOut_A and CallI of the call as part of this opcode
+            uint cacheId = funcInfo->FindOrAddInlineCacheId(protoLocation, propertyId, true, false);
+            byteCodeGenerator->Writer()->PatchableProperty(Js::OpCode::LdMethodFldCallI, pnodeTarget->location, protoLocation, cacheId);
+        }
+        else
+        {
+            EmitMethodFld(pnodeTarget, protoLocation, propertyId, byteCodeGenerator, funcInfo);
+        }
 
         // Function calls on the 'super' object should maintain current 'this' pointer
         *thisLocation = (pnodeTarget->sxBin.pnode1->nop == knopSuper) ? funcInfo->thisPointerRegister : pnodeTarget->sxBin.pnode1->location;
@@ -8255,7 +8265,14 @@ void EmitCall(
     }
     else
     {
-        EmitCallTarget(pnodeTarget, fSideEffectArgs, &thisLocation, &callObjLocation, byteCodeGenerator, funcInfo);
+        // A method call without arguments, o.f(), is emitted as LdMethodFldCallI, StartCall, ArgOut_A and CallI.
+        // The first opcode loads the method and lets the interpreter run the other three without dispatching them.
+        bool fFuseMethodCall = !fIsPut && !fIsEval && !fHasNewTarget && argCount == 1 &&
+            overrideThisLocation == Js::Constants::NoRegister &&
+            pnodeTarget->nop == knopDot && pnodeTarget->sxBin.pnode1->nop != knopSuper &&
+            !byteCodeGenerator->IsInDebugMode();
+
+        EmitCallTarget(pnodeTarget, fSideEffectArgs, &thisLocation, &callObjLocation, byteCodeGenerator, funcInfo, fFuseMethodCall);
     }
 
     bool releaseThisLocation = true;
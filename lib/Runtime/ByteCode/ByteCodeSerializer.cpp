@@ -2240,9 +2240,10 @@ public:
     Utf8SourceInfo *utf8SourceInfo;
     uint sourceIndex;
     bool const isLibraryCode;
+    bool const isPinned;
 public:
-    ByteCodeBufferReader(ScriptContext * scriptContext, byte * raw, bool isLibraryCode, int builtInPropertyCount)
-        : scriptContext(scriptContext), raw(raw), utf8SourceInfo(nullptr), isLibraryCode(isLibraryCode),
+    ByteCodeBufferReader(ScriptContext * scriptContext, byte * raw, bool isLibraryCode, bool isPinned, int builtInPropertyCount)
+        : scriptContext(scriptContext), raw(raw), utf8SourceInfo(nullptr), isLibraryCode(isLibraryCode), isPinned(isPinned),
         expectedFunctionBodySize(sizeof(unaligned FunctionBody)),
         expectedBuildInPropertyCount(builtInPropertyCount),
         expectedOpCodeCount((int)OpCode::Count)
@@ -2715,6 +2716,17 @@ public:
         current = ReadOffsetAsPointer(current, &sourceSpans);
         current = ReadOffsetAsPointer(current, &functions);
 
+        // The sections must start inside of the buffer; the string and line info tables are read right away
+        const byte * end = raw + totalSize;
+        if (current > end
+            || string16s == nullptr || string16s + sizeof(int32) > end
+            || lineInfoCaches == nullptr || lineInfoCaches + sizeof(int32) > end
+            || sourceSpans >= end
+            || functions == nullptr || functions >= end)
+        {
+            return ByteCodeSerializer::InvalidByteCode;
+        }
+
         // Read strings header
         string16IndexTable = (StringIndexRecord*)ReadInt32(string16s, &string16Count);
         lineInfoCache = (JsUtil::LineOffsetCache<Recycler>::LineOffsetCacheItem *)ReadInt32(lineInfoCaches, &lineInfoCacheCount);
@@ -2884,7 +2896,8 @@ public:
                     uint32 len;
                     current = ReadStringConstant(current, function, string, len);
 
-                    function->RecordStrConstant(reg, string, len);
+                    // A pinned buffer outlives every string of the script context, so refer to the string table in place
+                    function->RecordStrConstant(reg, string, len, /* copyBuffer */ !isPinned);
                     break;
                 }
             case ctStringTemplateCallsite:
@@ -4133,6 +4146,19 @@ HRESULT ByteCodeSerializer::DeserializeFromBuffer(ScriptContext * scriptContext,
     AssertMsg(sourceHolder != nullptr, "SourceHolder can't be null, if you have an empty source then pass ISourceHolder::GetEmptySourceHolder()");
     return ByteCodeSerializer::DeserializeFromBufferInternal(scriptContext, scriptFlags, /* utf8Source */ nullptr, sourceHolder, srcInfo, buffer, nativeModule, function, sourceIndex);
 }
+bool ByteCodeSerializer::IsCompleteBuffer(const byte * buffer, size_t bufferSize)
+{
+    if (bufferSize < 2 * sizeof(int32))
+    {
+        return false;
+    }
+
+    // Magic number followed by the total size, neither of which is variable size encoded
+    const int32 magic = *(const int32 *)buffer;
+    const int32 totalSize = *(const int32 *)(buffer + sizeof(int32));
+    return magic == magicConstant && totalSize > 0 && (size_t)totalSize == bufferSize;
+}
+
 HRESULT ByteCodeSerializer::DeserializeFromBufferInternal(ScriptContext * scriptContext, uint32 scriptFlags, LPCUTF8 utf8Source, ISourceHolder* sourceHolder, SRCINFO const * srcInfo, byte * buffer, NativeModule *nativeModule, FunctionBody** function, uint sourceIndex)
 {
     //ETW Event start
@@ -4140,8 +4166,9 @@ HRESULT ByteCodeSerializer::DeserializeFromBufferInternal(ScriptContext * script
 
     auto alloc = scriptContext->SourceCodeAllocator();
     bool isLibraryCode = ((scriptFlags & fscrIsLibraryCode) == fscrIsLibraryCode);
+    bool isPinned = ((scriptFlags & fscrPinnedByteCode) == fscrPinnedByteCode);
     int builtInPropertyCount = isLibraryCode ? PropertyIds::_countJSOnlyProperty : TotalNumberOfBuiltInProperties;
-    auto reader = Anew(alloc, ByteCodeBufferReader, scriptContext, buffer, isLibraryCode, builtInPropertyCount);
+    auto reader = Anew(alloc, ByteCodeBufferReader, scriptContext, buffer, isLibraryCode, isPinned, builtInPropertyCount);
     auto hr = reader->ReadHeader();
     if (FAILED(hr))
     {
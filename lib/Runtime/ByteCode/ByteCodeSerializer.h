@@ -162,6 +162,9 @@ namespace Js
 
         static FunctionBody* DeserializeFunction(ScriptContext* scriptContext, DeferDeserializeFunctionInfo* deferredFunction);
 
+        // Check that a buffer of bufferSize bytes, read from outside of the engine, holds all of the serialized byte code its header describes
+        static bool IsCompleteBuffer(const byte * buffer, size_t bufferSize);
+
         // This lib doesn't directly depend on the generated interfaces. Ensure the same codes with a C_ASSERT
         static const HRESULT CantGenerate = 0x80020201L;
         static const HRESULT InvalidByteCode = 0x80020202L;
@@ -421,6 +421,13 @@ namespace Js
         unit.cacheId = Js::Constants::NoInlineCacheIndex;
         callRegToLdFldCacheIndexMap->TryGetValueAndRemove(R1, &unit);
 
+        // A register copied onto itself does nothing. Keep it when debugging so that every statement still
+        // has the byte code the debugger expects to step over.
+        if (op == OpCode::Ld_A && R0 == R1 && !m_isInDebugMode)
+        {
+            return;
+        }
+
         bool isProfiled = false;
         bool isProfiled2 = false;
         bool isReg2WithICIndex = false;
@@ -2078,6 +2085,7 @@ StoreCommon:
             }
             break;
         case OpCode::LdMethodFld:
+        case OpCode::LdMethodFldCallI:
             if (registerCacheIdForCall)
             {
                 CacheIdUnit unit(cacheId);
@@ -611,8 +611,22 @@ namespace Js
             }
         }
         deferParseFunction->SetIsAsmjsMode(true);
-        PageAllocator tempPageAlloc(NULL, Js::Configuration::Global.flags);
-        Parser ps(GetScriptContext(), FALSE, &tempPageAlloc);
+        PageAllocator * parsePageAllocator = nullptr;
+#if ENABLE_NATIVE_CODEGEN
+        // Reuse warm pages from the process-wide pool instead of a fresh allocator for every function
+        AutoReturnPageAllocator autoReturnPageAllocator;
+        if (PageAllocatorPool::CanUseForPolicy(GetScriptContext()->GetThreadContext()->GetAllocationPolicyManager()))
+        {
+            parsePageAllocator = autoReturnPageAllocator.GetPageAllocator();
+        }
+#endif
+        AutoPtr<PageAllocator> tempPageAlloc(nullptr);
+        if (parsePageAllocator == nullptr)
+        {
+            tempPageAlloc = HeapNew(PageAllocator, NULL, Js::Configuration::Global.flags);
+            parsePageAllocator = tempPageAlloc;
+        }
+        Parser ps(GetScriptContext(), FALSE, parsePageAllocator);
         FunctionBody * funcBody;
         ParseNodePtr parseTree;
 
@@ -7,7 +7,7 @@
 #if ENABLE_NATIVE_CODEGEN
 namespace Js
 {
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
     DynamicProfileInfo::DynamicProfileInfo()
     {
         hasFunctionBody = false;
@@ -550,6 +550,8 @@ namespace Js
         localPolyCallSiteInfo->functionIds[1] = functionId;
         localPolyCallSiteInfo->sourceIds[0] = oldSourceId;
         localPolyCallSiteInfo->sourceIds[1] = sourceId;
+        localPolyCallSiteInfo->callCounts[0] = 1;
+        localPolyCallSiteInfo->callCounts[1] = 1;
         localPolyCallSiteInfo->next = funcBody->GetPolymorphicCallSiteInfoHead();
 
         for (int i = 2; i < maxPolymorphicInliningSize; i++)
@@ -562,20 +564,6 @@ namespace Js
         funcBody->SetPolymorphicCallSiteInfoHead(localPolyCallSiteInfo);
     }
 
-    void DynamicProfileInfo::ResetAllPolymorphicCallSiteInfo()
-    {
-        if (dynamicProfileFunctionInfo)
-        {
-            for (ProfileId i = 0; i < dynamicProfileFunctionInfo->callSiteInfoCount; i++)
-            {
-                if (callSiteInfo[i].isPolymorphic)
-                {
-                    ResetPolymorphicCallSiteInfo(i, CallSiteMixed);
-                }
-            }
-        }
-    }
-
     void DynamicProfileInfo::ResetPolymorphicCallSiteInfo(ProfileId callSiteId, Js::LocalFunctionId functionId)
     {
         callSiteInfo[callSiteId].isPolymorphic = false;
@@ -586,23 +574,54 @@ namespace Js
 
     void DynamicProfileInfo::SetFunctionIdSlotForNewPolymorphicCall(ProfileId callSiteId, Js::LocalFunctionId curFunctionId, Js::SourceId curSourceId, Js::FunctionBody *inliner)
     {
+        PolymorphicCallSiteInfo *const polymorphicCallSiteInfo = callSiteInfo[callSiteId].u.polymorphicCallSiteInfo;
         for (int i = 0; i < maxPolymorphicInliningSize; i++)
         {
-            if (callSiteInfo[callSiteId].u.polymorphicCallSiteInfo->functionIds[i] == curFunctionId &&
-                callSiteInfo[callSiteId].u.polymorphicCallSiteInfo->sourceIds[i] == curSourceId)
+            if (polymorphicCallSiteInfo->functionIds[i] == curFunctionId &&
+                polymorphicCallSiteInfo->sourceIds[i] == curSourceId)
             {
                 // we have it already
+                if (polymorphicCallSiteInfo->callCounts[i] != UINT16_MAX)
+                {
+                    polymorphicCallSiteInfo->callCounts[i]++;
+                }
                 return;
             }
-            else if (callSiteInfo[callSiteId].u.polymorphicCallSiteInfo->functionIds[i] == CallSiteNoInfo)
+            else if (polymorphicCallSiteInfo->functionIds[i] == CallSiteNoInfo)
             {
-                callSiteInfo[callSiteId].u.polymorphicCallSiteInfo->functionIds[i] = curFunctionId;
-                callSiteInfo[callSiteId].u.polymorphicCallSiteInfo->sourceIds[i] = curSourceId;
+                polymorphicCallSiteInfo->functionIds[i] = curFunctionId;
+                polymorphicCallSiteInfo->sourceIds[i] = curSourceId;
+                polymorphicCallSiteInfo->callCounts[i] = 1;
                 this->currentInlinerVersion++;
                 return;
             }
         }
 
+        if (CONFIG_FLAG_RELEASE(MegamorphicInline))
+        {
+            // Keep the most called targets instead of giving up on the call site. The new target takes the slot of the
+            // least called one and inherits its count (space saving top-k), so a target has to be called more often than
+            // the coldest one to stay. Calls to the targets that are not kept go through a regular call in the JIT'd code
+            // instead of bailing out, so the inliner version does not need to change here.
+            int coldestIndex = 0;
+            for (int i = 1; i < maxPolymorphicInliningSize; i++)
+            {
+                if (polymorphicCallSiteInfo->callCounts[i] < polymorphicCallSiteInfo->callCounts[coldestIndex])
+                {
+                    coldestIndex = i;
+                }
+            }
+
+            polymorphicCallSiteInfo->functionIds[coldestIndex] = curFunctionId;
+            polymorphicCallSiteInfo->sourceIds[coldestIndex] = curSourceId;
+            if (polymorphicCallSiteInfo->callCounts[coldestIndex] != UINT16_MAX)
+            {
+                polymorphicCallSiteInfo->callCounts[coldestIndex]++;
+            }
+            polymorphicCallSiteInfo->hasTail = true;
+            return;
+        }
+
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
         if (Js::Configuration::Global.flags.TestTrace.IsEnabled(Js::PolymorphicInlinePhase))
         {
@@ -739,11 +758,36 @@ namespace Js
                     }
                 }
             }
+
+            if (polymorphicCallSiteInfo->hasTail)
+            {
+                // Only the most called targets are known for this call site, order them by how often they were called
+                uint16 callCounts[DynamicProfileInfo::maxPolymorphicInliningSize];
+                for (uint i = 0; i < functionBodyArrayLength; i++)
+                {
+                    callCounts[i] = polymorphicCallSiteInfo->callCounts[i];
+                    for (uint j = i; j > 0 && callCounts[j - 1] < callCounts[j]; j--)
+                    {
+                        const uint16 callCount = callCounts[j];
+                        callCounts[j] = callCounts[j - 1];
+                        callCounts[j - 1] = callCount;
+
+                        FunctionBody *const body = functionBodyArray[j];
+                        functionBodyArray[j] = functionBodyArray[j - 1];
+                        functionBodyArray[j - 1] = body;
+                    }
+                }
+            }
             return true;
         }
         return false;
     }
 
+    bool DynamicProfileInfo::IsMegamorphicCallSite(ProfileId callSiteId) const
+    {
+        return callSiteInfo[callSiteId].isPolymorphic && callSiteInfo[callSiteId].u.polymorphicCallSiteInfo->hasTail;
+    }
+
     bool DynamicProfileInfo::HasCallSiteInfo(FunctionBody* functionBody, ProfileId callSiteId)
     {
         Assert(functionBody);
@@ -1054,6 +1098,36 @@ namespace Js
         return (ImplicitCallFlags)(this->implicitCallFlags & ImplicitCall_All);
     }
 
+#if ENABLE_JIT_WARMUP_CACHE
+    uint32 DynamicProfileInfo::GetProfileFingerprint(FunctionBody *const functionBody) const
+    {
+        // Summarize the parts of the profile that decide the shape of the full JIT code the most: implicit calls,
+        // parameter types, the optimizations disabled by earlier bailouts, and how many times the function was rejitted.
+        uint32 hash = GetImplicitCallFlags();
+        const auto Combine = [&hash](const uint32 value)
+        {
+            hash = _rotl(hash, 7);
+            hash ^= value;
+        };
+
+        const ArgSlot paramCount = functionBody->GetProfiledInParamsCount();
+        for (ArgSlot i = 0; i < paramCount; i++)
+        {
+            Combine(this->parameterInfo[i].GetRawData());
+        }
+
+        // The profile is zero allocated, so the unused bits of the bit field are stable
+        const byte *const bitsBytes = reinterpret_cast<const byte *>(&this->bits);
+        for (size_t i = 0; i < sizeof(this->bits); i++)
+        {
+            Combine(bitsBytes[i]);
+        }
+
+        Combine(this->rejitCount);
+        return hash;
+    }
+#endif
+
     void DynamicProfileInfo::UpdateFunctionInfo(FunctionBody* functionBody, Recycler* recycler)
     {
         Assert(this->persistsAcrossScriptContexts);
@@ -1235,9 +1309,14 @@ namespace Js
                     {
                         if (callSiteInfo[i].u.polymorphicCallSiteInfo->functionIds[j] != CallSiteNoInfo)
                         {
-                            Output::Print(_u(" %4d:%4d"), callSiteInfo[i].u.polymorphicCallSiteInfo->sourceIds[j], callSiteInfo[i].u.polymorphicCallSiteInfo->functionIds[j]);
+                            Output::Print(_u(" %4d:%4d(%d)"), callSiteInfo[i].u.polymorphicCallSiteInfo->sourceIds[j], callSiteInfo[i].u.polymorphicCallSiteInfo->functionIds[j],
+                                callSiteInfo[i].u.polymorphicCallSiteInfo->callCounts[j]);
                         }
                     }
+                    if (callSiteInfo[i].u.polymorphicCallSiteInfo->hasTail)
+                    {
+                        Output::Print(_u(" +tail"));
+                    }
                 }
             }
             Output::Print(_u("\n"));
@@ -1734,26 +1813,25 @@ namespace Js
     }
 #endif
 
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
 #if DBG_DUMP
-    void BufferWriter::Log(DynamicProfileInfo* info)
+    void BufferWriter::Log(DynamicProfileInfo* info, FunctionBody* functionBody)
     {
-        if (Configuration::Global.flags.Dump.IsEnabled(DynamicProfilePhase, info->GetFunctionBody()->GetSourceContextId(), info->GetFunctionBody()->GetLocalFunctionId()))
+        if (Configuration::Global.flags.Dump.IsEnabled(DynamicProfilePhase, functionBody->GetSourceContextId(), functionBody->GetLocalFunctionId()))
         {
             Output::Print(_u("Saving:"));
-            info->Dump(info->GetFunctionBody());
+            info->Dump(functionBody);
         }
     }
 #endif
 
     template <typename T>
-    bool DynamicProfileInfo::Serialize(T * writer)
+    bool DynamicProfileInfo::Serialize(T * writer, FunctionBody * functionBody)
     {
 #if DBG_DUMP
-        writer->Log(this);
+        writer->Log(this, functionBody);
 #endif
 
-        FunctionBody * functionBody = this->GetFunctionBody();
         Js::ArgSlot paramInfoCount = functionBody->GetProfiledInParamsCount();
         if (!writer->Write(functionBody->GetLocalFunctionId())
             || !writer->Write(paramInfoCount)
@@ -1769,7 +1847,7 @@ namespace Js
             || !writer->Write(functionBody->GetProfiledSlotCount())
             || !writer->WriteArray(this->slotInfo, functionBody->GetProfiledSlotCount())
             || !writer->Write(functionBody->GetProfiledCallSiteCount())
-            || !writer->WriteArray(this->callSiteInfo, functionBody->GetProfiledCallSiteCount())
+            || !this->SerializeCallSiteInfo(writer, functionBody->GetProfiledCallSiteCount())
             || !writer->Write(functionBody->GetProfiledDivOrRemCount())
             || !writer->WriteArray(this->divideTypeInfo, functionBody->GetProfiledDivOrRemCount())
             || !writer->Write(functionBody->GetProfiledSwitchCount())
@@ -1790,7 +1868,33 @@ namespace Js
     }
 
     template <typename T>
-    DynamicProfileInfo * DynamicProfileInfo::Deserialize(T * reader, Recycler* recycler, Js::LocalFunctionId * functionId)
+    bool DynamicProfileInfo::SerializeCallSiteInfo(T * writer, ProfileId callSiteCount)
+    {
+        for (ProfileId i = 0; i < callSiteCount; i++)
+        {
+            CallSiteInfo info = this->callSiteInfo[i];
+            if (info.isPolymorphic)
+            {
+                // The polymorphic call site info is a pointer into this process, only keep that the call site is mixed
+                info.isPolymorphic = false;
+                info.u.functionData.sourceId = InvalidSourceId;
+                info.u.functionData.functionId = CallSiteMixed;
+            }
+
+            if (!writer->Write(info))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //
+    // The record comes from outside the process, so every count is checked against the function body before anything is
+    // allocated for it, and anything that would be used as a pointer or an index without further checks is rejected.
+    //
+    template <typename T>
+    DynamicProfileInfo * DynamicProfileInfo::Deserialize(T * reader, Recycler* recycler, FunctionBody * functionBody)
     {
         Js::ArgSlot paramInfoCount = 0;
         ProfileId ldElemInfoCount = 0;
@@ -1824,14 +1928,15 @@ namespace Js
         {
             AUTO_NESTED_HANDLED_EXCEPTION_TYPE(ExceptionType_OutOfMemory);
 
-            if (!reader->Read(functionId))
+            Js::LocalFunctionId functionId;
+            if (!reader->Read(&functionId) || functionId != functionBody->GetLocalFunctionId())
             {
-                return nullptr;
+                goto Error;
             }
 
-            if (!reader->Read(&paramInfoCount))
+            if (!reader->Read(&paramInfoCount) || paramInfoCount != functionBody->GetProfiledInParamsCount())
             {
-                return nullptr;
+                goto Error;
             }
 
             if (paramInfoCount != 0)
@@ -1843,7 +1948,7 @@ namespace Js
                 }
             }
 
-            if (!reader->Read(&ldElemInfoCount))
+            if (!reader->Read(&ldElemInfoCount) || ldElemInfoCount != functionBody->GetProfiledLdElemCount())
             {
                 goto Error;
             }
@@ -1857,7 +1962,7 @@ namespace Js
                 }
             }
 
-            if (!reader->Read(&stElemInfoCount))
+            if (!reader->Read(&stElemInfoCount) || stElemInfoCount != functionBody->GetProfiledStElemCount())
             {
                 goto Error;
             }
@@ -1871,7 +1976,7 @@ namespace Js
                 }
             }
 
-            if (!reader->Read(&arrayCallSiteCount))
+            if (!reader->Read(&arrayCallSiteCount) || arrayCallSiteCount != functionBody->GetProfiledArrayCallSiteCount())
             {
                 goto Error;
             }
@@ -1885,7 +1990,7 @@ namespace Js
                 }
             }
 
-            if (!reader->Read(&fldInfoCount))
+            if (!reader->Read(&fldInfoCount) || fldInfoCount != functionBody->GetProfiledFldCount())
             {
                 goto Error;
             }
@@ -1899,7 +2004,7 @@ namespace Js
                 }
             }
 
-            if (!reader->Read(&slotInfoCount))
+            if (!reader->Read(&slotInfoCount) || slotInfoCount != functionBody->GetProfiledSlotCount())
             {
                 goto Error;
             }
@@ -1913,7 +2018,7 @@ namespace Js
                 }
             }
 
-            if (!reader->Read(&callSiteInfoCount))
+            if (!reader->Read(&callSiteInfoCount) || callSiteInfoCount != functionBody->GetProfiledCallSiteCount())
             {
                 goto Error;
             }
@@ -1925,9 +2030,20 @@ namespace Js
                 {
                     goto Error;
                 }
+
+                for (ProfileId i = 0; i < callSiteInfoCount; i++)
+                {
+                    // Serialize never writes polymorphic call sites, whose info is a pointer
+                    if (callSiteInfo[i].isPolymorphic ||
+                        (callSiteInfo[i].ldFldInlineCacheId != Js::Constants::NoInlineCacheIndex &&
+                            callSiteInfo[i].ldFldInlineCacheId >= functionBody->GetInlineCacheCount()))
+                    {
+                        goto Error;
+                    }
+                }
             }
 
-            if (!reader->Read(&divCount))
+            if (!reader->Read(&divCount) || divCount != functionBody->GetProfiledDivOrRemCount())
             {
                 goto Error;
             }
@@ -1941,7 +2057,7 @@ namespace Js
                 }
             }
 
-            if (!reader->Read(&switchCount))
+            if (!reader->Read(&switchCount) || switchCount != functionBody->GetProfiledSwitchCount())
             {
                 goto Error;
             }
@@ -1955,7 +2071,7 @@ namespace Js
                 }
             }
 
-            if (!reader->Read(&returnTypeInfoCount))
+            if (!reader->Read(&returnTypeInfoCount) || returnTypeInfoCount != functionBody->GetProfiledReturnTypeCount())
             {
                 goto Error;
             }
@@ -1969,7 +2085,7 @@ namespace Js
                 }
             }
 
-            if (!reader->Read(&loopCount))
+            if (!reader->Read(&loopCount) || loopCount != functionBody->GetLoopCount())
             {
                 goto Error;
             }
@@ -2033,8 +2149,6 @@ namespace Js
             dynamicProfileInfo->m_recursiveInlineInfo = recursiveInlineInfo;
 
             // Fixed functions and object type data is not serialized. There is no point in trying to serialize polymorphic call site info.
-            dynamicProfileInfo->ResetAllPolymorphicCallSiteInfo();
-
             return dynamicProfileInfo;
         }
         catch (OutOfMemoryException)
@@ -2046,9 +2160,12 @@ namespace Js
     }
 
     // Explicit instantiations - to force the compiler to generate these - so they can be referenced from other compilation units.
-    template DynamicProfileInfo * DynamicProfileInfo::Deserialize<BufferReader>(BufferReader*, Recycler*, Js::LocalFunctionId *);
-    template bool DynamicProfileInfo::Serialize<BufferSizeCounter>(BufferSizeCounter*);
-    template bool DynamicProfileInfo::Serialize<BufferWriter>(BufferWriter*);
+    template DynamicProfileInfo * DynamicProfileInfo::Deserialize<BufferReader>(BufferReader*, Recycler*, FunctionBody *);
+    template bool DynamicProfileInfo::Serialize<BufferSizeCounter>(BufferSizeCounter*, FunctionBody*);
+    template bool DynamicProfileInfo::Serialize<BufferWriter>(BufferWriter*, FunctionBody*);
+#endif
+
+#ifdef DYNAMIC_PROFILE_STORAGE
 
     void DynamicProfileInfo::UpdateSourceDynamicProfileManagers(ScriptContext * scriptContext)
     {
@@ -391,6 +391,7 @@ namespace Js
         uint16 GetConstantArgInfo(ProfileId callSiteId);
         uint GetLdFldCacheIndexFromCallSiteInfo(FunctionBody* functionBody, ProfileId callSiteId);
         bool GetPolymorphicCallSiteInfo(FunctionBody* functionBody, ProfileId callSiteId, bool *isConstructorCall, __inout_ecount(functionBodyArrayLength) FunctionBody** functionBodyArray, uint functionBodyArrayLength);
+        bool IsMegamorphicCallSite(ProfileId callSiteId) const;
 
         bool RecordLdFldCallSiteInfo(FunctionBody* functionBody, RecyclableObject* callee, bool callApplyTarget);
 
@@ -412,10 +413,13 @@ namespace Js
         void RecordImplicitCallFlags(ImplicitCallFlags flags);
         ImplicitCallFlags GetImplicitCallFlags() const;
 
+#if ENABLE_JIT_WARMUP_CACHE
+        uint32 GetProfileFingerprint(FunctionBody *const functionBody) const;
+#endif
+
         static void Save(ScriptContext * scriptContext);
 
         void UpdateFunctionInfo(FunctionBody* functionBody, Recycler* allocator);
-        void    ResetAllPolymorphicCallSiteInfo();
 
         bool CallSiteHasProfileData(ProfileId callSiteId)
         {
@@ -563,15 +567,18 @@ namespace Js
 #if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
         FunctionBody * functionBody; // This will only be populated if NeedProfileInfoList is true
 #endif
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
         // Used by de-serialize
         DynamicProfileInfo();
 
         template <typename T>
-        static DynamicProfileInfo * Deserialize(T * reader, Recycler* allocator, Js::LocalFunctionId * functionId);
+        static DynamicProfileInfo * Deserialize(T * reader, Recycler* allocator, FunctionBody * functionBody);
         template <typename T>
-        bool Serialize(T * writer);
-
+        bool Serialize(T * writer, FunctionBody * functionBody);
+        template <typename T>
+        bool SerializeCallSiteInfo(T * writer, ProfileId callSiteCount);
+#endif
+#ifdef DYNAMIC_PROFILE_STORAGE
         static void UpdateSourceDynamicProfileManagers(ScriptContext * scriptContext);
 #endif
         static Js::LocalFunctionId const CallSiteMixed = (Js::LocalFunctionId)-1;
@@ -825,6 +832,10 @@ namespace Js
     {
         Js::LocalFunctionId functionIds[DynamicProfileInfo::maxPolymorphicInliningSize];
         Js::SourceId sourceIds[DynamicProfileInfo::maxPolymorphicInliningSize];
+        // Approximate number of calls to each of the targets above, saturating
+        uint16 callCounts[DynamicProfileInfo::maxPolymorphicInliningSize];
+        // Calls were also made to targets that did not fit in the slots above
+        bool hasTail;
         PolymorphicCallSiteInfo *next;
         bool GetFunction(uint index, Js::LocalFunctionId *functionId, Js::SourceId *sourceId)
         {
@@ -841,7 +852,7 @@ namespace Js
         }
     };
 
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
     class BufferReader
     {
     public:
@@ -884,6 +895,13 @@ namespace Js
             lengthLeft -= size;
             return true;
         }
+
+        // Check a length read from the buffer before allocating room for the array
+        template <typename T>
+        bool CanReadArray(size_t len) const
+        {
+            return len <= lengthLeft / sizeof(T);
+        }
     private:
         char const * current;
         size_t lengthLeft;
@@ -901,7 +919,7 @@ namespace Js
         }
 
 #if DBG_DUMP
-        void Log(DynamicProfileInfo* info) {}
+        void Log(DynamicProfileInfo* info, FunctionBody* functionBody) {}
 #endif
 
         template <typename T>
@@ -926,7 +944,7 @@ namespace Js
         }
 
 #if DBG_DUMP
-        void Log(DynamicProfileInfo* info);
+        void Log(DynamicProfileInfo* info, FunctionBody* functionBody);
 #endif
         template <typename T>
         bool WriteArray(__in_ecount(len) T * data, size_t len)
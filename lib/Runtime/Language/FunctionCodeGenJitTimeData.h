@@ -54,6 +54,9 @@ namespace Js
         // This indicates the function is aggressively Inlined(see NativeCodeGenerator::TryAggressiveInlining) .
         bool isAggressiveInliningEnabled;
 
+        // For polymorphic call sites, calls also reach targets that are not in the chain of inlinees
+        bool hasPolymorphicTail;
+
         // The profiled iterations need to be determined at the time of gathering code gen data on the main thread
         const uint16 profiledIterations;
 
@@ -156,6 +159,14 @@ namespace Js
         {
             isAggressiveInliningEnabled = true;
         }
+        bool GetHasPolymorphicTail() const
+        {
+            return hasPolymorphicTail;
+        }
+        void SetHasPolymorphicTail()
+        {
+            hasPolymorphicTail = true;
+        }
 
         void SetupRecursiveInlineeChain(
             Recycler *const recycler,
@@ -37,6 +37,19 @@
 #define PROFILEDOP(prof, unprof) unprof
 #endif
 
+// Threaded dispatch jumps from the end of each handler straight to the next opcode's handler through a table
+// of label addresses, giving every handler its own indirect branch to predict instead of sharing the one at
+// the top of the switch. The debugging loop has to check for breaks before every opcode and keeps the switch.
+#if ENABLE_THREADED_INTERPRETER_DISPATCH && !DEBUGGING_LOOP && !defined(INTERPRETER_ASMJS) && !defined(ENABLE_BASIC_TELEMETRY)
+#define THREADED_DISPATCH_LOOP 1
+#else
+#define THREADED_DISPATCH_LOOP 0
+#endif
+
+// Handlers in the prefix functions below, and in loops without threaded dispatch, are plain switch cases
+#define INTERPRETER_CASE(name) case INTERPRETER_OPCODE::name:
+#define INTERPRETER_NEXT_OPCODE() break
+
 //two layers of macros are necessary to get arguments to the invocation of the top level macro expanded.
 #define CONCAT_TOKENS_AGAIN(loopName, fnSuffix) loopName ## fnSuffix
 #define CONCAT_TOKENS(loopName, fnSuffix) CONCAT_TOKENS_AGAIN(loopName, fnSuffix)
@@ -183,6 +196,54 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
     // For checked builds this does mean we are incrementing 2 different counters to
     // track the ip.
     const byte* ip = m_reader.GetIP();
+
+#if THREADED_DISPATCH_LOOP
+#define THREADED_DISPATCH_LABEL(name) CONCAT_TOKENS(ThreadedDispatch_, name)
+#undef INTERPRETER_CASE
+#undef INTERPRETER_NEXT_OPCODE
+#define INTERPRETER_CASE(name) case INTERPRETER_OPCODE::name: THREADED_DISPATCH_LABEL(name):
+#define INTERPRETER_NEXT_OPCODE() \
+    { \
+        op = READ_OP(ip); \
+        goto *threadedDispatchTable[(uint)op]; \
+    }
+
+    // Filled once per loop from the same handler list as the switch below, so that the table and the switch
+    // can't disagree. One byte opcodes without a handler in this loop go to the default case.
+    static void * const * const threadedDispatchTable = ({
+        static void * table[(uint)INTERPRETER_OPCODE::MaxByteSizedOpcodes + 1];
+        for (uint i = 0; i < _countof(table); i++)
+        {
+            table[i] = &&THREADED_DISPATCH_LABEL(InvalidOpcode);
+        }
+
+#define THREADED_DISPATCH_ENTRY(op) \
+        CompileAssert(INTERPRETER_OPCODE::op <= INTERPRETER_OPCODE::MaxByteSizedOpcodes); \
+        table[(uint)INTERPRETER_OPCODE::op] = &&THREADED_DISPATCH_LABEL(op);
+#define DEF2(x, op, func) THREADED_DISPATCH_ENTRY(op)
+#define DEF3(x, op, func, y) THREADED_DISPATCH_ENTRY(op)
+#define DEF2_WMS(x, op, func) THREADED_DISPATCH_ENTRY(op)
+#define DEF3_WMS(x, op, func, y) THREADED_DISPATCH_ENTRY(op)
+#define DEF4_WMS(x, op, func, y, t) THREADED_DISPATCH_ENTRY(op)
+#include "InterpreterHandler.inl"
+
+        // Handled directly in the switch below
+        THREADED_DISPATCH_ENTRY(Ret)
+        THREADED_DISPATCH_ENTRY(Yield)
+        THREADED_DISPATCH_ENTRY(Leave)
+        THREADED_DISPATCH_ENTRY(LeaveNull)
+        THREADED_DISPATCH_ENTRY(ExtendedOpcodePrefix)
+        THREADED_DISPATCH_ENTRY(ExtendedMediumLayoutPrefix)
+        THREADED_DISPATCH_ENTRY(ExtendedLargeLayoutPrefix)
+        THREADED_DISPATCH_ENTRY(MediumLayoutPrefix)
+        THREADED_DISPATCH_ENTRY(LargeLayoutPrefix)
+        THREADED_DISPATCH_ENTRY(EndOfBlock)
+        THREADED_DISPATCH_ENTRY(Break)
+#undef THREADED_DISPATCH_ENTRY
+        table;
+    });
+#endif
+
     while (true)
     {
         INTERPRETER_OPCODE op = READ_OP(ip);
@@ -271,10 +332,13 @@ Js::Var Js::InterpreterStackFrame::INTERPRETERLOOPNAME()
             }
         }
 SWAP_BP_FOR_OPCODE:
+#endif
+#if THREADED_DISPATCH_LOOP
+        goto *threadedDispatchTable[(uint)op];
 #endif
         switch (op)
         {
-        case INTERPRETER_OPCODE::Ret:
+        INTERPRETER_CASE(Ret)
             {
                 //
                 // Return "Reg: 0" as the return-value.
@@ -291,7 +355,7 @@ SWAP_BP_FOR_OPCODE:
             }
 
 #ifndef INTERPRETER_ASMJS
-        case INTERPRETER_OPCODE::Yield:
+        INTERPRETER_CASE(Yield)
             {
                 m_reader.Reg2_Small(ip);
                 return GetReg(GetFunctionBody()->GetYieldRegister());
@@ -307,13 +371,13 @@ SWAP_BP_FOR_OPCODE:
 #include "InterpreterHandler.inl"
 
 #ifndef INTERPRETER_ASMJS
-            case INTERPRETER_OPCODE::Leave:
+            INTERPRETER_CASE(Leave)
                 // Return the continuation address to the helper.
                 // This tells the helper that control left the scope without completing the try/handler,
                 // which is particularly significant when executing a finally.
                 m_reader.Empty(ip);
                 return (Var)this->m_reader.GetCurrentOffset();
-            case INTERPRETER_OPCODE::LeaveNull:
+            INTERPRETER_CASE(LeaveNull)
                 // Return to the helper without specifying a continuation address,
                 // indicating that the handler completed without jumping, so exception processing
                 // should continue.
@@ -335,33 +399,33 @@ SWAP_BP_FOR_OPCODE:
 #endif
 
 #define ExtendedCase(opcode) \
-            case INTERPRETER_OPCODE::opcode: \
+            INTERPRETER_CASE(opcode) \
                 ip = PROCESS_OPCODE_FN_NAME(opcode)(ip); \
                 CHECK_SWITCH_PROFILE_MODE(); \
-                break;
+                INTERPRETER_NEXT_OPCODE();
             ExtendedCase(ExtendedOpcodePrefix)
             ExtendedCase(ExtendedMediumLayoutPrefix)
             ExtendedCase(ExtendedLargeLayoutPrefix)
 
-            case INTERPRETER_OPCODE::MediumLayoutPrefix:
+            INTERPRETER_CASE(MediumLayoutPrefix)
             {
                 Var yieldValue = nullptr;
                 ip = PROCESS_OPCODE_FN_NAME(MediumLayoutPrefix)(ip, yieldValue);
                 CHECK_YIELD_VALUE();
                 CHECK_SWITCH_PROFILE_MODE();
-                break;
+                INTERPRETER_NEXT_OPCODE();
             }
 
-            case INTERPRETER_OPCODE::LargeLayoutPrefix:
+            INTERPRETER_CASE(LargeLayoutPrefix)
             {
                 Var yieldValue = nullptr;
                 ip = PROCESS_OPCODE_FN_NAME(LargeLayoutPrefix)(ip, yieldValue);
                 CHECK_YIELD_VALUE();
                 CHECK_SWITCH_PROFILE_MODE();
-                break;
+                INTERPRETER_NEXT_OPCODE();
             }
 
-            case INTERPRETER_OPCODE::EndOfBlock:
+            INTERPRETER_CASE(EndOfBlock)
             {
                 // Note that at this time though ip was advanced by 'OpCode op = ReadByteOp<INTERPRETER_OPCODE>(ip)',
                 // we haven't advanced m_reader.m_currentLocation yet, thus m_reader.m_currentLocation still points to EndOfBLock,
@@ -387,7 +451,7 @@ SWAP_BP_FOR_OPCODE:
             }
 
 #ifndef INTERPRETER_ASMJS
-            case INTERPRETER_OPCODE::Break:
+            INTERPRETER_CASE(Break)
             {
 #if DEBUGGING_LOOP
                 // The reader has already advanced the IP:
@@ -464,10 +528,13 @@ SWAP_BP_FOR_OPCODE:
 #else
                 m_reader.Empty(ip);
 #endif
-                break;
+                INTERPRETER_NEXT_OPCODE();
             }
 #endif
             default:
+#if THREADED_DISPATCH_LOOP
+            THREADED_DISPATCH_LABEL(InvalidOpcode):
+#endif
                 // Help the C++ optimizer by declaring that the cases we
                 // have above are sufficient
                 AssertMsg(false, "dispatch to bad opcode");
@@ -488,3 +555,7 @@ SWAP_BP_FOR_OPCODE:
 #undef INTERPRETER_OPCODE
 #undef CHECK_SWITCH_PROFILE_MODE
 #undef CHECK_YIELD_VALUE
+#undef THREADED_DISPATCH_LOOP
+#undef THREADED_DISPATCH_LABEL
+#undef INTERPRETER_CASE
+#undef INTERPRETER_NEXT_OPCODE
@@ -133,6 +133,9 @@ namespace Js
 #if DBG || DBG_DUMP
         void * DEBUG_currentByteOffset;
 #endif
+#if DBG_DUMP
+        Js::OpCode DEBUG_previousOpCode;
+#endif
 
         // Asm.js stack pointer
         int* m_localIntSlots;
@@ -762,6 +765,7 @@ namespace Js
         uint CallAsmJsLoopBody(JavascriptMethod address);
         void DoInterruptProbe();
         void CheckIfLoopIsHot(uint profiledLoopCounter);
+        void PromoteEnclosingLoop(LoopHeader *const loopHeader, const uint32 loopNumber);
         bool CheckAndResetImplicitCall(DisableImplicitFlags prevDisableImplicitFlags,ImplicitCallFlags savedImplicitCallFlags);
         class PushPopFrameHelper
         {
@@ -4829,6 +4829,74 @@ CommonNumber:
         return returnValue;
     }
 
+    // Element-wise memops only handle the typed arrays whose element arithmetic the JIT maps to them: int32 wrapping
+    // addition, and float32/float64 arithmetic done in double precision. Anything else bails out to the loop.
+    BOOL JavascriptOperators::OP_Memadd(Var instance, int32 start, Var value, int32 length, ScriptContext* scriptContext)
+    {
+        if (length <= 0)
+        {
+            return false;
+        }
+        TypeId valueType = JavascriptOperators::GetTypeId(value);
+        if (valueType != TypeIds_Integer && valueType != TypeIds_Number)
+        {
+            return false;
+        }
+
+        switch (JavascriptOperators::GetTypeId(instance))
+        {
+        case TypeIds_Int32Array:
+        {
+            const uint32 addend = (uint32)JavascriptConversion::ToInt32(value, scriptContext);
+            return Int32Array::FromVar(instance)->DirectMapItemAtRange(start, length, [addend](int32 element) { return (int32)((uint32)element + addend); });
+        }
+        case TypeIds_Float32Array:
+        {
+            const double addend = JavascriptConversion::ToNumber(value, scriptContext);
+            return Float32Array::FromVar(instance)->DirectMapItemAtRange(start, length, [addend](float element) { return (float)(element + addend); });
+        }
+        case TypeIds_Float64Array:
+        {
+            const double addend = JavascriptConversion::ToNumber(value, scriptContext);
+            return Float64Array::FromVar(instance)->DirectMapItemAtRange(start, length, [addend](double element) { return element + addend; });
+        }
+        default:
+            AssertMsg(false, "We don't support this type for memadd.");
+            return false;
+        }
+    }
+
+    BOOL JavascriptOperators::OP_Memmul(Var instance, int32 start, Var value, int32 length, ScriptContext* scriptContext)
+    {
+        if (length <= 0)
+        {
+            return false;
+        }
+        TypeId valueType = JavascriptOperators::GetTypeId(value);
+        if (valueType != TypeIds_Integer && valueType != TypeIds_Number)
+        {
+            return false;
+        }
+
+        switch (JavascriptOperators::GetTypeId(instance))
+        {
+        case TypeIds_Float32Array:
+        {
+            const double factor = JavascriptConversion::ToNumber(value, scriptContext);
+            return Float32Array::FromVar(instance)->DirectMapItemAtRange(start, length, [factor](float element) { return (float)(element * factor); });
+        }
+        case TypeIds_Float64Array:
+        {
+            const double factor = JavascriptConversion::ToNumber(value, scriptContext);
+            return Float64Array::FromVar(instance)->DirectMapItemAtRange(start, length, [factor](double element) { return element * factor; });
+        }
+        default:
+            // Int32 multiplication does not wrap like ToInt32 of the double product, so the JIT never emits it
+            AssertMsg(false, "We don't support this type for memmul.");
+            return false;
+        }
+    }
+
     Var JavascriptOperators::OP_DeleteElementI_UInt32(Var instance, uint32 index, ScriptContext* scriptContext, PropertyOperationFlags propertyOperationFlags)
     {
 #if FLOATVAR
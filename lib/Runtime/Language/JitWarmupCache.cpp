@@ -0,0 +1,268 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeLanguagePch.h"
+
+#if ENABLE_JIT_WARMUP_CACHE
+namespace Js
+{
+    CriticalSection JitWarmupCache::cs;
+    JitWarmupCache::SourceRecordMap * JitWarmupCache::sourceRecords = nullptr;
+    bool JitWarmupCache::isShutdown = false;
+    DWORD const JitWarmupCache::MagicNumber = 20170412;
+    DWORD const JitWarmupCache::FileFormatVersion = 2;
+
+    bool JitWarmupCache::IsEnabled()
+    {
+        return Configuration::Global.flags.IsEnabled(JitWarmupCacheDirFlag) && !PHASE_OFF1(JitWarmupCachePhase);
+    }
+
+    void JitWarmupCache::Shutdown()
+    {
+        AutoCriticalSection autoCS(&cs);
+        if (isShutdown)
+        {
+            return;
+        }
+        isShutdown = true;
+
+        if (sourceRecords == nullptr)
+        {
+            return;
+        }
+
+        sourceRecords->Map([](uint64, JitWarmupSourceRecord * record)
+        {
+            if (record->dirty)
+            {
+                SaveSourceRecord(record);
+            }
+            NoCheckHeapDelete(record);
+        });
+        NoCheckHeapDelete(sourceRecords);
+        sourceRecords = nullptr;
+    }
+
+    JitWarmupSourceRecord * JitWarmupCache::GetSourceRecord(Utf8SourceInfo *const utf8SourceInfo)
+    {
+        Assert(cs.IsLocked());
+        Assert(!isShutdown);
+
+        JitWarmupSourceRecord * record = utf8SourceInfo->GetJitWarmupRecord();
+        if (record != nullptr)
+        {
+            return record;
+        }
+
+        // Library and eval/new Function code is not worth a file of its own
+        if (utf8SourceInfo->GetIsLibraryCode() || utf8SourceInfo->IsDynamic() || !utf8SourceInfo->HasSource())
+        {
+            return nullptr;
+        }
+
+        if (sourceRecords == nullptr)
+        {
+            sourceRecords = NoCheckHeapNew(SourceRecordMap, &NoCheckHeapAllocator::Instance);
+        }
+
+        const uint32 sourceHash = (uint32)Utf8SourceInfo::StaticGetHashCode(utf8SourceInfo);
+        const size_t sourceLength = utf8SourceInfo->GetCbLength(_u("JitWarmupCache::GetSourceRecord"));
+        const uint64 key = ((uint64)sourceLength << 32) | sourceHash;
+        if (!sourceRecords->TryGetValue(key, &record))
+        {
+            record = LoadSourceRecord(sourceHash, sourceLength);
+            sourceRecords->Add(key, record);
+        }
+
+        utf8SourceInfo->SetJitWarmupRecord(record);
+        return record;
+    }
+
+    bool JitWarmupCache::ShouldFastTrack(FunctionBody *const functionBody)
+    {
+        if (!IsEnabled() || functionBody->IsInDebugMode())
+        {
+            return false;
+        }
+
+        AutoCriticalSection autoCS(&cs);
+        if (isShutdown)
+        {
+            return false;
+        }
+
+        JitWarmupSourceRecord *const record = GetSourceRecord(functionBody->GetUtf8SourceInfo());
+        JitWarmupSourceRecord::FunctionRecord functionRecord;
+        if (record == nullptr ||
+            !record->functions.TryGetValue(functionBody->GetLocalFunctionId(), &functionRecord) ||
+            !functionRecord.confirmed ||
+            functionRecord.byteCodeCount != functionBody->GetByteCodeCount())
+        {
+            return false;
+        }
+
+        if (PHASE_TRACE(JitWarmupCachePhase, functionBody))
+        {
+            char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
+            Output::Print(_u("JitWarmupCache: %s (%s) fast tracked with profile 0x%08x\n"),
+                functionBody->GetDisplayName(), functionBody->GetDebugNumberSet(debugStringBuffer), functionRecord.profileFingerprint);
+            Output::Flush();
+        }
+        return true;
+    }
+
+    void JitWarmupCache::RecordFullJit(FunctionBody *const functionBody)
+    {
+        if (!IsEnabled() || !functionBody->HasDynamicProfileInfo() || functionBody->IsInDebugMode())
+        {
+            return;
+        }
+
+        DynamicProfileInfo *const profileInfo = functionBody->GetAnyDynamicProfileInfo();
+
+        AutoCriticalSection autoCS(&cs);
+        if (isShutdown)
+        {
+            return;
+        }
+
+        JitWarmupSourceRecord *const record = GetSourceRecord(functionBody->GetUtf8SourceInfo());
+        if (record == nullptr)
+        {
+            return;
+        }
+
+        const LocalFunctionId functionId = functionBody->GetLocalFunctionId();
+        JitWarmupSourceRecord::FunctionRecord oldRecord;
+        const bool hasOldRecord =
+            record->functions.TryGetValue(functionId, &oldRecord) &&
+            oldRecord.byteCodeCount == functionBody->GetByteCodeCount();
+
+        char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
+        if (hasOldRecord && oldRecord.confirmed)
+        {
+            // The function was fast tracked on the recorded profile, so the profile seen now is a short one and is not
+            // compared against it. Only a rejit shows that the short profile was not good enough.
+            if (profileInfo->GetRejitCount() == 0)
+            {
+                return;
+            }
+
+            if (PHASE_TRACE(JitWarmupCachePhase, functionBody))
+            {
+                Output::Print(_u("JitWarmupCache: %s (%s) full JIT profile 0x%08x retracted after rejit\n"),
+                    functionBody->GetDisplayName(), functionBody->GetDebugNumberSet(debugStringBuffer), oldRecord.profileFingerprint);
+                Output::Flush();
+            }
+
+            record->functions.Remove(functionId);
+            record->dirty = true;
+            return;
+        }
+
+        // Tie the profile to the script it was observed on
+        const uint32 profileFingerprint = _rotl(record->sourceHash, 7) ^ profileInfo->GetProfileFingerprint(functionBody);
+
+        JitWarmupSourceRecord::FunctionRecord newRecord;
+        newRecord.byteCodeCount = functionBody->GetByteCodeCount();
+        newRecord.profileFingerprint = profileFingerprint;
+        newRecord.confirmed = hasOldRecord && oldRecord.profileFingerprint == profileFingerprint;
+
+        if (PHASE_TRACE(JitWarmupCachePhase, functionBody))
+        {
+            Output::Print(_u("JitWarmupCache: %s (%s) full JIT profile 0x%08x %s\n"),
+                functionBody->GetDisplayName(), functionBody->GetDebugNumberSet(debugStringBuffer), profileFingerprint,
+                newRecord.confirmed ? _u("confirmed") : _u("recorded"));
+            Output::Flush();
+        }
+
+        record->functions.Item(functionId, newRecord);
+        record->dirty = true;
+    }
+
+    void JitWarmupCache::GetFilename(JitWarmupSourceRecord const *const record, _Out_writes_z_(_MAX_PATH) char16 filename[_MAX_PATH])
+    {
+        swprintf_s(filename, _MAX_PATH, _u("%s/jitwarmup_%08x_%08x.jwc"),
+            (char16 const *)Configuration::Global.flags.JitWarmupCacheDir, record->sourceHash, (uint32)record->sourceLength);
+    }
+
+    JitWarmupSourceRecord * JitWarmupCache::LoadSourceRecord(uint32 sourceHash, size_t sourceLength)
+    {
+        JitWarmupSourceRecord * record = NoCheckHeapNew(JitWarmupSourceRecord, sourceHash, sourceLength);
+
+        char16 filename[_MAX_PATH];
+        GetFilename(record, filename);
+
+        FILE * file;
+        if (_wfopen_s(&file, filename, _u("rb")) != 0)
+        {
+            // Not seen in an earlier run
+            return record;
+        }
+
+        DWORD header[2];
+        uint32 storedSourceHash;
+        uint64 storedSourceLength;
+        uint32 count;
+        if (fread(header, sizeof(header), 1, file) == 1 &&
+            header[0] == MagicNumber && header[1] == FileFormatVersion &&
+            fread(&storedSourceHash, sizeof(storedSourceHash), 1, file) == 1 && storedSourceHash == sourceHash &&
+            fread(&storedSourceLength, sizeof(storedSourceLength), 1, file) == 1 && storedSourceLength == sourceLength &&
+            fread(&count, sizeof(count), 1, file) == 1)
+        {
+            for (uint32 i = 0; i < count; i++)
+            {
+                LocalFunctionId functionId;
+                JitWarmupSourceRecord::FunctionRecord functionRecord;
+                if (fread(&functionId, sizeof(functionId), 1, file) != 1 ||
+                    fread(&functionRecord, sizeof(functionRecord), 1, file) != 1)
+                {
+                    // Truncated by a concurrent writer, start over rather than trust a partial record
+                    record->functions.Clear();
+                    break;
+                }
+                record->functions.Item(functionId, functionRecord);
+            }
+        }
+
+        fclose(file);
+        return record;
+    }
+
+    void JitWarmupCache::SaveSourceRecord(JitWarmupSourceRecord *const record)
+    {
+        char16 filename[_MAX_PATH];
+        GetFilename(record, filename);
+
+        FILE * file;
+        if (_wfopen_s(&file, filename, _u("wb")) != 0)
+        {
+            return;
+        }
+
+        const DWORD header[2] = { MagicNumber, FileFormatVersion };
+        const uint64 sourceLength = record->sourceLength;
+        const uint32 count = record->functions.Count();
+        bool success =
+            fwrite(header, sizeof(header), 1, file) == 1 &&
+            fwrite(&record->sourceHash, sizeof(record->sourceHash), 1, file) == 1 &&
+            fwrite(&sourceLength, sizeof(sourceLength), 1, file) == 1 &&
+            fwrite(&count, sizeof(count), 1, file) == 1;
+
+        record->functions.Map([&](LocalFunctionId functionId, JitWarmupSourceRecord::FunctionRecord const& functionRecord)
+        {
+            success = success &&
+                fwrite(&functionId, sizeof(functionId), 1, file) == 1 &&
+                fwrite(&functionRecord, sizeof(functionRecord), 1, file) == 1;
+        });
+
+        fclose(file);
+        if (!success)
+        {
+            _wunlink(filename);
+        }
+        record->dirty = false;
+    }
+}
+#endif
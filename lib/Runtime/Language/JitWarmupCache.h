@@ -0,0 +1,76 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#if ENABLE_JIT_WARMUP_CACHE
+namespace Js
+{
+    // Per script record of the functions that reached the full JIT tier, keyed by the function's local id
+    class JitWarmupSourceRecord
+    {
+    public:
+        struct FunctionRecord
+        {
+            uint32 byteCodeCount;
+            uint32 profileFingerprint;
+            // The same profile fingerprint was seen by two consecutive runs
+            uint32 confirmed;
+        };
+
+        typedef JsUtil::BaseDictionary<LocalFunctionId, FunctionRecord, NoCheckHeapAllocator> FunctionRecordMap;
+
+        JitWarmupSourceRecord(uint32 sourceHash, size_t sourceLength) :
+            sourceHash(sourceHash), sourceLength(sourceLength), functions(&NoCheckHeapAllocator::Instance), dirty(false)
+        {
+        }
+
+        uint32 sourceHash;
+        size_t sourceLength;
+        FunctionRecordMap functions;
+        bool dirty;
+    };
+
+    //
+    // JitWarmupCache remembers across process restarts which functions of a script were full JITed, and with what
+    // profile, so that a restarted process can send those functions to the full JIT after the minimum number of
+    // profiled iterations instead of walking them through the interpreter and simple JIT tiers again.
+    //
+    // Native code itself is not persisted: it embeds process specific addresses (types, inline caches, property
+    // guards and other NativeCodeData) and is always regenerated from the fresh profile. The persisted profile
+    // fingerprint takes the place of guard revalidation; a function is only fast tracked once two consecutive runs
+    // with the usual warm-up agreed on it. The fingerprint of a confirmed function is kept as recorded: a fast tracked
+    // run sees a shorter profile by design and is not compared against it, and only retracts the function when the
+    // short profile leads to a rejit.
+    //
+    // Enabled with -JitWarmupCacheDir:<directory>. Records are loaded per script on first use and written back on
+    // process shutdown.
+    //
+    class JitWarmupCache
+    {
+    public:
+        static bool IsEnabled();
+        static void Shutdown();
+
+        // Called when the function's execution mode limits are initialized
+        static bool ShouldFastTrack(FunctionBody *const functionBody);
+        // Called when full JIT code for the function is installed
+        static void RecordFullJit(FunctionBody *const functionBody);
+
+    private:
+        static JitWarmupSourceRecord * GetSourceRecord(Utf8SourceInfo *const utf8SourceInfo);
+        static JitWarmupSourceRecord * LoadSourceRecord(uint32 sourceHash, size_t sourceLength);
+        static void SaveSourceRecord(JitWarmupSourceRecord *const record);
+        static void GetFilename(JitWarmupSourceRecord const *const record, _Out_writes_z_(_MAX_PATH) char16 filename[_MAX_PATH]);
+
+        typedef JsUtil::BaseDictionary<uint64, JitWarmupSourceRecord *, NoCheckHeapAllocator> SourceRecordMap;
+
+        static CriticalSection cs;
+        static SourceRecordMap * sourceRecords;
+        static bool isShutdown;
+        static DWORD const MagicNumber;
+        static DWORD const FileFormatVersion;
+    };
+}
+#endif
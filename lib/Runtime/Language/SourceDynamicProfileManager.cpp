@@ -25,6 +25,19 @@ namespace Js
     {
         Js::LocalFunctionId functionId = functionBody->GetLocalFunctionId();
         DynamicProfileInfo * dynamicProfileInfo = nullptr;
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+        char const * serializedRecord;
+        if (serializedRecordMap.Count() > 0 && serializedRecordMap.TryGetValueAndRemove(functionId, &serializedRecord))
+        {
+            // Loaded records are only deserialized now that the function body they must match is known
+            BufferReader reader(serializedRecord + sizeof(uint), *(uint const *)serializedRecord);
+            dynamicProfileInfo = DynamicProfileInfo::Deserialize(&reader, this->recycler, functionBody);
+            if (dynamicProfileInfo != nullptr)
+            {
+                dynamicProfileInfoMap.Item(functionId, dynamicProfileInfo);
+            }
+        }
+#endif
         if (dynamicProfileInfoMap.Count() > 0 && dynamicProfileInfoMap.TryGetValue(functionId, &dynamicProfileInfo))
         {
             if (dynamicProfileInfo->MatchFunctionBody(functionBody))
@@ -49,6 +62,9 @@ namespace Js
     SourceDynamicProfileManager::Reset(uint numberOfFunctions)
     {
         dynamicProfileInfoMap.Clear();
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+        serializedRecordMap.Clear();
+#endif
     }
 
     void SourceDynamicProfileManager::UpdateDynamicProfileInfo(LocalFunctionId functionId, DynamicProfileInfo * dynamicProfileInfo)
@@ -337,7 +353,9 @@ namespace Js
         Assert(dynamicProfileInfo->GetFunctionBody()->HasExecutionDynamicProfileInfo());
         dynamicProfileInfoMap.Item(functionId, dynamicProfileInfo);
     }
+#endif
 
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
     template <typename T>
     SourceDynamicProfileManager *
     SourceDynamicProfileManager::Deserialize(T * reader, Recycler* recycler)
@@ -376,22 +394,34 @@ namespace Js
         }
 #endif
 
+        // Keep a copy of each record, prefixed with its size. They are deserialized by GetDynamicProfileInfo, which can
+        // check them against the function body they are for.
         for (uint i = 0; i < profileCount; i++)
         {
+            uint recordSize;
             Js::LocalFunctionId functionId;
-            DynamicProfileInfo * dynamicProfileInfo = DynamicProfileInfo::Deserialize(reader, recycler, &functionId);
-            if (dynamicProfileInfo == nullptr || functionId >= functionCount)
+            if (!reader->Read(&recordSize)
+                || !reader->template CanReadArray<char>(recordSize)
+                || !reader->Peek(&functionId)
+                || functionId >= functionCount)
             {
                 return nullptr;
             }
-            sourceDynamicProfileManager->dynamicProfileInfoMap.Add(functionId, dynamicProfileInfo);
+
+            char * record = RecyclerNewArrayLeaf(recycler, char, sizeof(uint) + recordSize);
+            *(uint *)record = recordSize;
+            if (!reader->ReadArray(record + sizeof(uint), recordSize))
+            {
+                return nullptr;
+            }
+            sourceDynamicProfileManager->serializedRecordMap.Item(functionId, record);
         }
         return sourceDynamicProfileManager;
     }
 
     template <typename T>
     bool
-    SourceDynamicProfileManager::Serialize(T * writer)
+    SourceDynamicProfileManager::Serialize(T * writer, ProfiledFunctionList const * profiledFunctions)
     {
         // To simulate behavior of in memory profile cache - let's keep functions marked as executed if they were loaded
         // to be so from the profile - this helps with ensure inlined functions are marked as executed.
@@ -404,46 +434,196 @@ namespace Js
             this->startupFunctions->Or(cachedStartupFunctions);
         }
 
-        if(this->startupFunctions)
+        if(!this->startupFunctions)
         {
+            // Nothing has executed and nothing was loaded, the reader can't make sense of profiles without the bit vector
+            return false;
+        }
+
 #if DBG_DUMP
-             if(Configuration::Global.flags.Dump.IsEnabled(DynamicProfilePhase))
-            {
-                Output::Print(_u("Saving: Startup functions bit vector:"));
-                this->startupFunctions->Dump();
-            }
+        if(Configuration::Global.flags.Dump.IsEnabled(DynamicProfilePhase))
+        {
+            Output::Print(_u("Saving: Startup functions bit vector:"));
+            this->startupFunctions->Dump();
+        }
 #endif
 
-            size_t bvSize = BVFixed::GetAllocSize(this->startupFunctions->Length()) ;
-            if (!writer->WriteArray((char *)this->startupFunctions, bvSize)
-                || !writer->Write(this->dynamicProfileInfoMap.Count()))
+        size_t bvSize = BVFixed::GetAllocSize(this->startupFunctions->Length()) ;
+        if (!writer->WriteArray((char *)this->startupFunctions, bvSize)
+            || !writer->Write((uint)profiledFunctions->Count()))
+        {
+            return false;
+        }
+
+        for (int i = 0; i < profiledFunctions->Count(); i++)
+        {
+            FunctionBody * functionBody = profiledFunctions->Item(i);
+            DynamicProfileInfo * dynamicProfileInfo = functionBody->GetAnyDynamicProfileInfo();
+
+            // Prefix each record with its size so that loading can copy the records without deserializing them
+            BufferSizeCounter recordSize;
+            if (!dynamicProfileInfo->Serialize(&recordSize, functionBody)
+                || recordSize.GetByteCount() > UINT_MAX
+                || !writer->Write(static_cast<uint>(recordSize.GetByteCount()))
+                || !dynamicProfileInfo->Serialize(writer, functionBody))
             {
                 return false;
             }
         }
+        return true;
+    }
+
+    //
+    // The in memory layout of the profile data is written as is, so a serialized profile is only good for the exact same build
+    //
+    template <typename T>
+    bool
+    SourceDynamicProfileManager::SerializeWithHeader(T * writer, ProfiledFunctionList const * profiledFunctions)
+    {
+        DWORD majorVersion;
+        DWORD minorVersion;
+        DWORD buildDateHash;
+        DWORD buildTimeHash;
+        if (FAILED(AutoSystemInfo::GetJscriptFileVersion(&majorVersion, &minorVersion, &buildDateHash, &buildTimeHash)))
+        {
+            return false;
+        }
 
-        for (int i = 0; i < this->dynamicProfileInfoMap.Count(); i++)
+        return writer->Write(SerializedMagic)
+            && writer->Write(majorVersion)
+            && writer->Write(minorVersion)
+            && writer->Write(buildDateHash)
+            && writer->Write(buildTimeHash)
+            && this->Serialize(writer, profiledFunctions);
+    }
+
+    //
+    // Serializes the profile of the functions of a host source context that have executed. Follows the usual
+    // buffer size protocol: with a null buffer only the required size is returned in bufferSize.
+    //
+    HRESULT
+    SourceDynamicProfileManager::SerializeToBuffer(ScriptContext* scriptContext, SourceContextInfo* info, BYTE* buffer, DWORD* bufferSize)
+    {
+        Assert(info != nullptr);
+        SourceDynamicProfileManager * manager = info->sourceDynamicProfileManager;
+        if (manager == nullptr || info->IsDynamic())
+        {
+            return E_INVALIDARG;
+        }
+
+        ProfiledFunctionList profiledFunctions(&HeapAllocator::Instance);
+        scriptContext->MapScript([&](Utf8SourceInfo* utf8SourceInfo)
         {
-            DynamicProfileInfo * dynamicProfileInfo = this->dynamicProfileInfoMap.GetValueAt(i);
-            if (dynamicProfileInfo == nullptr || !dynamicProfileInfo->HasFunctionBody())
+            if (utf8SourceInfo->GetSourceContextInfo() != info)
             {
-                continue;
+                return;
             }
 
-            if (!dynamicProfileInfo->Serialize(writer))
+            utf8SourceInfo->MapFunction([&](FunctionBody* functionBody)
             {
-                return false;
-            }
+                if (functionBody->HasExecutionDynamicProfileInfo() && !functionBody->GetIsAsmjsMode())
+                {
+                    profiledFunctions.Add(functionBody);
+                }
+            });
+        });
+
+        BufferSizeCounter counter;
+        if (!manager->SerializeWithHeader(&counter, &profiledFunctions))
+        {
+            return E_FAIL;
         }
-        return true;
+
+        if (counter.GetByteCount() > UINT_MAX)
+        {
+            return E_OUTOFMEMORY;
+        }
+
+        const DWORD size = static_cast<DWORD>(counter.GetByteCount());
+        if (buffer == nullptr)
+        {
+            *bufferSize = size;
+            return S_OK;
+        }
+
+        if (size > *bufferSize)
+        {
+            *bufferSize = size;
+            return E_INVALIDARG;
+        }
+
+        BufferWriter writer((char *)buffer, size);
+        if (!manager->SerializeWithHeader(&writer, &profiledFunctions))
+        {
+            Assert(false);
+            return E_FAIL;
+        }
+
+        *bufferSize = size;
+        OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Profile serialized. Function count: %d  Size: %u %s\n"),
+            profiledFunctions.Count(), size, info->url);
+        return S_OK;
+    }
+
+    SourceDynamicProfileManager *
+    SourceDynamicProfileManager::DeserializeFromBuffer(BYTE const* buffer, DWORD bufferSize, Recycler* recycler)
+    {
+        BufferReader reader((char const *)buffer, bufferSize);
+
+        DWORD jscriptMajorVersion;
+        DWORD jscriptMinorVersion;
+        DWORD jscriptBuildDateHash;
+        DWORD jscriptBuildTimeHash;
+        if (FAILED(AutoSystemInfo::GetJscriptFileVersion(&jscriptMajorVersion, &jscriptMinorVersion, &jscriptBuildDateHash, &jscriptBuildTimeHash)))
+        {
+            return nullptr;
+        }
+
+        DWORD magic;
+        DWORD majorVersion;
+        DWORD minorVersion;
+        DWORD buildDateHash;
+        DWORD buildTimeHash;
+        if (!reader.Read(&magic) || magic != SerializedMagic
+            || !reader.Read(&majorVersion) || majorVersion != jscriptMajorVersion
+            || !reader.Read(&minorVersion) || minorVersion != jscriptMinorVersion
+            || !reader.Read(&buildDateHash) || buildDateHash != jscriptBuildDateHash
+            || !reader.Read(&buildTimeHash) || buildTimeHash != jscriptBuildTimeHash)
+        {
+            OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Profile load failed. Version mismatch\n"));
+            return nullptr;
+        }
+
+        // Don't let a corrupt function count allocate a bit vector larger than the buffer could hold
+        uint functionCount;
+        if (!reader.Peek(&functionCount) || BVFixed::GetAllocSize(functionCount) > bufferSize)
+        {
+            return nullptr;
+        }
+
+        SourceDynamicProfileManager * manager = Deserialize(&reader, recycler);
+        OUTPUT_TRACE(Js::DynamicProfilePhase, _u("Profile load %s. Function count: %d\n"), manager ? _u("succeeded") : _u("failed"), functionCount);
+        return manager;
     }
+#endif
 
+#ifdef DYNAMIC_PROFILE_STORAGE
     void
     SourceDynamicProfileManager::SaveToDynamicProfileStorage(char16 const * url)
     {
         Assert(DynamicProfileStorage::IsEnabled());
+
+        ProfiledFunctionList profiledFunctions(&HeapAllocator::Instance);
+        this->dynamicProfileInfoMap.Map([&](LocalFunctionId, DynamicProfileInfo * dynamicProfileInfo)
+        {
+            if (dynamicProfileInfo != nullptr && dynamicProfileInfo->HasFunctionBody())
+            {
+                profiledFunctions.Add(dynamicProfileInfo->GetFunctionBody());
+            }
+        });
+
         BufferSizeCounter counter;
-        if (!this->Serialize(&counter))
+        if (!this->Serialize(&counter, &profiledFunctions))
         {
             return;
         }
@@ -463,7 +643,7 @@ namespace Js
 #endif
 
         BufferWriter writer(DynamicProfileStorage::GetRecordBuffer(record), counter.GetByteCount());
-        if (!this->Serialize(&writer))
+        if (!this->Serialize(&writer, &profiledFunctions))
         {
             Assert(false);
             DynamicProfileStorage::DeleteRecord(record);
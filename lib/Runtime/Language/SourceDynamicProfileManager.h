@@ -18,10 +18,17 @@ namespace Js
     // For every source file, an instance of SourceDynamicProfileManager is used to save/load data.
     // It uses the WININET cache to save/load profile data.
     // For testing scenarios enabled using DYNAMIC_PROFILE_STORAGE macro, this can persist the profile info into a file as well.
+    // Hosts can also save and restore it through JsSerializeProfile/JsLoadProfile (DYNAMIC_PROFILE_SERIALIZATION).
     class SourceDynamicProfileManager
     {
     public:
-        SourceDynamicProfileManager(Recycler* allocator) : isNonCachableScript(false), cachedStartupFunctions(nullptr), recycler(allocator), dynamicProfileInfoMap(allocator), startupFunctions(nullptr), profileDataCache(nullptr) {}
+        SourceDynamicProfileManager(Recycler* allocator) : isNonCachableScript(false), cachedStartupFunctions(nullptr), recycler(allocator), dynamicProfileInfoMap(allocator),
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+            serializedRecordMap(allocator),
+#endif
+            startupFunctions(nullptr), profileDataCache(nullptr)
+        {
+        }
 
         ExecutionFlags IsFunctionExecuted(Js::LocalFunctionId functionId);
         DynamicProfileInfo * GetDynamicProfileInfo(FunctionBody * functionBody);
@@ -37,6 +44,10 @@ namespace Js
         bool LoadFromProfileCache(IActiveScriptDataCache* profileDataCache, LPCWSTR url);
         IActiveScriptDataCache* GetProfileCache() { return profileDataCache; }
         uint GetStartupFunctionsLength() { return (this->startupFunctions ? this->startupFunctions->Length() : 0); }
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+        static HRESULT SerializeToBuffer(ScriptContext* scriptContext, SourceContextInfo* info, _Out_writes_bytes_opt_(*bufferSize) BYTE* buffer, _Inout_ DWORD* bufferSize);
+        static SourceDynamicProfileManager * DeserializeFromBuffer(_In_reads_bytes_(bufferSize) BYTE const* buffer, DWORD bufferSize, Recycler* recycler);
+#endif
 
     private:
         friend class DynamicProfileInfo;
@@ -45,10 +56,18 @@ namespace Js
 #ifdef DYNAMIC_PROFILE_STORAGE
         void SaveDynamicProfileInfo(LocalFunctionId functionId, DynamicProfileInfo * dynamicProfileInfo);
         void SaveToDynamicProfileStorage(char16 const * url);
+#endif
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+        typedef JsUtil::List<FunctionBody *, HeapAllocator> ProfiledFunctionList;
+
         template <typename T>
         static SourceDynamicProfileManager * Deserialize(T * reader, Recycler* allocator);
         template <typename T>
-        bool Serialize(T * writer);
+        bool Serialize(T * writer, ProfiledFunctionList const * profiledFunctions);
+        template <typename T>
+        bool SerializeWithHeader(T * writer, ProfiledFunctionList const * profiledFunctions);
+
+        static const DWORD SerializedMagic = 0x50444a43; // "CJDP"
 #endif
         uint SaveToProfileCache();
         bool ShouldSaveToProfileCache(SourceContextInfo* info) const;
@@ -62,6 +81,9 @@ namespace Js
         BVFixed const * cachedStartupFunctions;      // Bit vector representing functions executed at startup that are loaded from a persistent or in-memory cache
                                                      // It's not modified but used as an input for deferred parsing/bytecodegen
         JsUtil::BaseDictionary<LocalFunctionId, DynamicProfileInfo *, Recycler, PowerOf2SizePolicy> dynamicProfileInfoMap;
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
+        JsUtil::BaseDictionary<LocalFunctionId, char const *, Recycler, PowerOf2SizePolicy> serializedRecordMap;    // Loaded records not yet matched to a function body
+#endif
 
         static const uint MAX_FUNCTION_COUNT = 10000;  // Consider data corrupt if there are more functions than this
 
@@ -339,6 +339,15 @@ namespace Js
             // length is the minimum of length, srcLength and dstLength
             length = length < srcLength ? (length < dstLength ? length : dstLength) : (srcLength < dstLength ? srcLength : dstLength);
 
+            // Two views of the same buffer at different offsets: the element loop reads values it wrote earlier, which a
+            // copy does not reproduce. Fail before writing anything so that the caller runs the loop instead.
+            if (dstBuffer != srcBuffer &&
+                dstBuffer + start < srcBuffer + start + length &&
+                srcBuffer + start < dstBuffer + start + dstLength)
+            {
+                return false;
+            }
+
             const size_t byteSize = sizeof(TypeName) * length;
             Assert(byteSize >= length); // check for overflow
             js_memcpy_s(dstBuffer + start, dstLength * sizeof(TypeName), srcBuffer + start, byteSize);
@@ -409,6 +418,30 @@ namespace Js
             return TRUE;
         }
 
+        // Replaces every element in [start, start + length) with mapFunc(element). Nothing is written unless the whole
+        // range is in bounds, so on failure the caller can run the original loop instead. The loop is kept free of
+        // calls and checks so that the compiler can vectorize it once mapFunc is inlined.
+        template <typename TMapFunc>
+        inline BOOL DirectMapItemAtRange(__in int32 start, __in uint32 length, TMapFunc mapFunc)
+        {
+            if (CrossSite::IsCrossSiteObjectTyped(this) || this->IsDetachedBuffer())
+            {
+                return false;
+            }
+            if (start < 0 || length > GetLength() || (uint32)start > GetLength() - length)
+            {
+                return false;
+            }
+
+            TypeName* typedBuffer = (TypeName*)buffer + start;
+            for (uint32 i = 0; i < length; i++)
+            {
+                typedBuffer[i] = mapFunc(typedBuffer[i]);
+            }
+
+            return TRUE;
+        }
+
         inline BOOL BaseTypedDirectSetItem(__in uint32 index, __in Js::Var value, TypeName (*convFunc)(Var value, ScriptContext* scriptContext))
         {
             // This call can potentially invoke user code, and may end up detaching the underlying array (this).
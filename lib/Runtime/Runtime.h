@@ -419,6 +419,7 @@ enum tagDEBUG_EVENT_INFO_TYPE
 #include "Base/TempArenaAllocatorObject.h"
 #include "Language/ValueType.h"
 #include "Language/DynamicProfileInfo.h"
+#include "Language/JitWarmupCache.h"
 #include "Debug/SourceContextInfo.h"
 #include "Language/InlineCache.h"
 #include "Language/InlineCachePointerArray.h"
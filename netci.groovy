@@ -175,6 +175,10 @@ def CreateXPlatBuildTasks = { machine, platform, configTag, xplatBranch, nonDefa
         CreateXPlatBuildTask(isPR, "test", "", machine, platform,
             configTag, xplatBranch, nonDefaultTaskSetup, "--no-jit", "--variants disable_jit")
 
+        // Threaded (computed goto) interpreter dispatch, only tested with the JIT disabled
+        CreateXPlatBuildTask(isPR, "test", "", machine, platform,
+            configTag, xplatBranch, nonDefaultTaskSetup, "--threaded-interpreter", "--variants disable_jit")
+
         ['debug', 'test', 'release'].each { buildType ->
             def staticBuildConfigs = [true, false]
             if (platform == "osx") {
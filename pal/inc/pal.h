@@ -3346,6 +3346,13 @@ SetThreadPriority(
           IN HANDLE hThread,
           IN int nPriority);
 
+PALIMPORT
+DWORD_PTR
+PALAPI
+SetThreadAffinityMask(
+          IN HANDLE hThread,
+          IN DWORD_PTR dwThreadAffinityMask);
+
 PALIMPORT
 BOOL
 PALAPI
@@ -3476,6 +3483,7 @@ SetErrorMode(
 #define MEM_MAPPED                      0x40000
 #define MEM_TOP_DOWN                    0x100000
 #define MEM_WRITE_WATCH                 0x200000
+#define MEM_LARGE_PAGES                 0x20000000 // reserve huge page aligned memory, committed pages are advised to use transparent huge pages
 #define MEM_RESERVE_EXECUTABLE          0x40000000 // reserve memory using executable memory allocator
 
 PALIMPORT
@@ -3768,6 +3776,19 @@ VirtualAllocEx(
          IN DWORD flAllocationType,
          IN DWORD flProtect);
 
+#define NUMA_NO_PREFERRED_NODE ((DWORD) -1)
+
+PALIMPORT
+LPVOID
+PALAPI
+VirtualAllocExNuma(
+         IN HANDLE hProcess,
+         IN LPVOID lpAddress,
+         IN SIZE_T dwSize,
+         IN DWORD flAllocationType,
+         IN DWORD flProtect,
+         IN DWORD nndPreferred);
+
 PALIMPORT
 BOOL
 PALAPI
@@ -5916,6 +5937,26 @@ BOOL
 PALAPI
 PAL_HasGetCurrentProcessorNumber();
 
+PALIMPORT
+BOOL
+PALAPI
+GetNumaHighestNodeNumber(
+    OUT PULONG HighestNodeNumber);
+
+PALIMPORT
+BOOL
+PALAPI
+GetNumaProcessorNode(
+    IN UCHAR Processor,
+    OUT PUCHAR NodeNumber);
+
+PALIMPORT
+BOOL
+PALAPI
+GetNumaNodeProcessorMask(
+    IN UCHAR Node,
+    OUT PULONGLONG ProcessorMask);
+
 #define FORMAT_MESSAGE_ALLOCATE_BUFFER 0x00000100
 #define FORMAT_MESSAGE_IGNORE_INSERTS  0x00000200
 #define FORMAT_MESSAGE_FROM_STRING     0x00000400
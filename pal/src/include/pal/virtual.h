@@ -36,6 +36,8 @@ typedef struct _CMI {
 
     DWORD  accessProtection;    /* Initial allocation access protection. */
     DWORD  allocationType;      /* Initial allocation type. */
+    DWORD  preferredNode;       /* NUMA node committed pages are bound to, or */
+                                /* NUMA_NO_PREFERRED_NODE. */
 
     BYTE * pAllocState;         /* Individual allocation type tracking for each */
                                 /* page in the region. */
@@ -37,6 +37,10 @@ Abstract:
 #include <unistd.h>
 #include <limits.h>
 
+#ifdef __LINUX__
+#include <sys/syscall.h>
+#endif // __LINUX__
+
 #if HAVE_VM_ALLOCATE
 #include <mach/vm_map.h>
 #include <mach/mach_init.h>
@@ -48,6 +52,10 @@ SET_DEFAULT_DEBUG_CHANNEL(VIRTUAL);
 
 CRITICAL_SECTION virtual_critsec PAL_GLOBAL;
 
+// Alignment of MEM_LARGE_PAGES reservations, the size of an x64/arm64 transparent huge page.
+static const SIZE_T VIRTUAL_HUGE_PAGE_SIZE = 0x200000;
+static const SIZE_T VIRTUAL_HUGE_PAGE_MASK = VIRTUAL_HUGE_PAGE_SIZE - 1;
+
 #if MMAP_IGNORES_HINT
 typedef struct FREE_BLOCK {
     char *startBoundary;
@@ -105,6 +113,19 @@ static LPVOID ReserveVirtualMemory(
                 IN LPVOID lpAddress,        /* Region to reserve or commit */
                 IN SIZE_T dwSize);          /* Size of Region */
 
+static LPVOID VIRTUALReserveHugePageAlignedMemory(
+                IN CPalThread *pthrCurrent, /* Currently executing thread */
+                IN SIZE_T MemSize);         /* Size of Region */
+
+static void VIRTUALAdviseHugePages(
+                IN UINT_PTR StartBoundary,  /* Start of the committed run */
+                IN SIZE_T MemSize);         /* Size of the committed run */
+
+static void VIRTUALBindToNode(
+                IN UINT_PTR StartBoundary,  /* Start of the committed run */
+                IN SIZE_T MemSize,          /* Size of the committed run */
+                IN DWORD nndPreferred);     /* NUMA node to allocate from */
+
 
 // A memory allocator that allocates memory from a pre-reserved region
 // of virtual memory that is located near the coreclr library.
@@ -810,6 +831,7 @@ static BOOL VIRTUALStoreAllocationInfo(
     pNewEntry->memSize          = memSize;
     pNewEntry->allocationType   = flAllocationType;
     pNewEntry->accessProtection = flProtection;
+    pNewEntry->preferredNode    = NUMA_NO_PREFERRED_NODE;
 
     nBufferSize = memSize / VIRTUAL_PAGE_SIZE / CHAR_BIT;
     if ( ( memSize / VIRTUAL_PAGE_SIZE ) % CHAR_BIT != 0 )
@@ -938,6 +960,13 @@ static LPVOID VIRTUALReserveMemory(
         pRetVal = g_executableMemoryAllocator.AllocateMemory(MemSize);
     }
 
+    // Huge page segments need to start on a huge page boundary for the kernel to back them
+    // with huge pages, which the 64K aligned reservation below doesn't guarantee.
+    if ((pRetVal == NULL) && ((flAllocationType & MEM_LARGE_PAGES) != 0) && (lpAddress == NULL))
+    {
+        pRetVal = VIRTUALReserveHugePageAlignedMemory(pthrCurrent, MemSize);
+    }
+
     if (pRetVal == NULL)
     {
         // Try to reserve memory from the OS
@@ -1067,6 +1096,101 @@ done:
     return pRetVal;
 }
 
+/******
+ *
+ *  VIRTUALReserveHugePageAlignedMemory() - Reserves a region that starts on a
+ *  huge page boundary. Returns NULL if that isn't supported on this platform,
+ *  in which case the caller falls back to a regular reservation.
+ *
+ */
+static LPVOID VIRTUALReserveHugePageAlignedMemory(
+                IN CPalThread *pthrCurrent, /* Currently executing thread */
+                IN SIZE_T MemSize)          /* Size of Region */
+{
+#if defined(MADV_HUGEPAGE) && !MMAP_IGNORES_HINT && !HAVE_VM_ALLOCATE
+    // Over-reserve by one huge page so that the region contains an aligned
+    // start, then give back the unaligned head and the tail.
+    SIZE_T reserveSize = MemSize + VIRTUAL_HUGE_PAGE_SIZE;
+    char *pReserved = (char *)ReserveVirtualMemory(pthrCurrent, NULL, reserveSize);
+    if (pReserved == NULL)
+    {
+        return NULL;
+    }
+
+    char *pAligned = (char *)(((UINT_PTR)pReserved + VIRTUAL_HUGE_PAGE_MASK) & ~VIRTUAL_HUGE_PAGE_MASK);
+    char *pAlignedEnd = pAligned + MemSize;
+    char *pReservedEnd = pReserved + reserveSize;
+
+    if (pAligned != pReserved)
+    {
+        munmap(pReserved, pAligned - pReserved);
+    }
+    if (pAlignedEnd != pReservedEnd)
+    {
+        munmap(pAlignedEnd, pReservedEnd - pAlignedEnd);
+    }
+
+    TRACE("Reserved huge page aligned region at %p\n", pAligned);
+    return pAligned;
+#else
+    return NULL;
+#endif
+}
+
+/******
+ *
+ *  VIRTUALAdviseHugePages() - Ask the kernel to back a freshly committed run
+ *  of a MEM_LARGE_PAGES region with transparent huge pages. Committing maps
+ *  the run anew, dropping any previous advice, so this is done on every commit.
+ *
+ */
+static void VIRTUALAdviseHugePages(
+                IN UINT_PTR StartBoundary,  /* Start of the committed run */
+                IN SIZE_T MemSize)          /* Size of the committed run */
+{
+#ifdef MADV_HUGEPAGE
+    if (madvise((void *) StartBoundary, MemSize, MADV_HUGEPAGE) != 0)
+    {
+        // Transparent huge pages may be disabled; the memory is still usable.
+        WARN("madvise(MADV_HUGEPAGE) failed! Error(%d)=%s\n", errno, strerror(errno));
+    }
+#endif // MADV_HUGEPAGE
+}
+
+/******
+ *
+ *  VIRTUALBindToNode() - Ask the kernel to back a freshly committed run with
+ *  memory from the given NUMA node. Like the huge page advice, the policy is
+ *  dropped when the run is remapped and has to be set again on every commit.
+ *
+ */
+static void VIRTUALBindToNode(
+                IN UINT_PTR StartBoundary,  /* Start of the committed run */
+                IN SIZE_T MemSize,          /* Size of the committed run */
+                IN DWORD nndPreferred)      /* NUMA node to allocate from */
+{
+#if defined(__LINUX__) && defined(__NR_mbind)
+    // MPOL_PREFERRED from <numaif.h>: allocate from the node if it has free
+    // memory, fall back to other nodes rather than failing the page fault.
+    const int MPOL_PREFERRED_MODE = 1;
+    unsigned long nodeMask;
+
+    if (nndPreferred >= sizeof(nodeMask) * CHAR_BIT)
+    {
+        WARN("NUMA node %u is out of range, ignoring it\n", nndPreferred);
+        return;
+    }
+
+    nodeMask = 1UL << nndPreferred;
+    // The kernel only looks at the first maxnode - 1 bits of the mask
+    if (syscall(__NR_mbind, (void *) StartBoundary, MemSize, MPOL_PREFERRED_MODE,
+                &nodeMask, sizeof(nodeMask) * CHAR_BIT + 1, 0) != 0)
+    {
+        WARN("mbind() failed! Error(%d)=%s\n", errno, strerror(errno));
+    }
+#endif // __LINUX__ && __NR_mbind
+}
+
 /******
  *
  *  VIRTUALCommitMemory() - Helper function that actually commits the memory.
@@ -1233,6 +1357,14 @@ static LPVOID VIRTUALCommitMemory(
                 ERROR("mmap() failed! Error(%d)=%s\n", errno, strerror(errno));
                 goto error;
             }
+            if ((pInformation->allocationType & MEM_LARGE_PAGES) != 0)
+            {
+                VIRTUALAdviseHugePages(StartBoundary, MemSize);
+            }
+            if (pInformation->preferredNode != NUMA_NO_PREFERRED_NODE)
+            {
+                VIRTUALBindToNode(StartBoundary, MemSize, pInformation->preferredNode);
+            }
             VIRTUALSetAllocState(MEM_COMMIT, runStart, runLength, pInformation);
 #if MMAP_DOESNOT_ALLOW_REMAP
             VIRTUALSetDirtyPages (0, runStart, runLength, pInformation);
@@ -1622,6 +1754,74 @@ VirtualAllocEx(
 {
     return VirtualAlloc(lpAddress, dwSize, flAllocationType, flProtect);
 }
+/*++
+Function:
+  VirtualAllocExNuma
+
+Note:
+  Only the current process is supported. The preferred node is recorded on
+  the reserved region, and every commit of pages in the region binds them to
+  that node (MPOL_PREFERRED), so memory is taken from other nodes rather than
+  failing when the preferred node is exhausted.
+
+See MSDN doc.
+--*/
+LPVOID
+PALAPI
+VirtualAllocExNuma(
+         IN HANDLE hProcess,
+         IN LPVOID lpAddress,       /* Region to reserve or commit */
+         IN SIZE_T dwSize,          /* Size of Region */
+         IN DWORD flAllocationType, /* Type of allocation */
+         IN DWORD flProtect,        /* Type of access protection */
+         IN DWORD nndPreferred)     /* Preferred NUMA node */
+{
+    LPVOID  pRetVal       = NULL;
+    CPalThread *pthrCurrent;
+    PCMI pInformation;
+
+    ENTRY("VirtualAllocExNuma(lpAddress=%p, dwSize=%u, flAllocationType=%#x, \
+          flProtect=%#x, nndPreferred=%u)\n", lpAddress, dwSize, flAllocationType, flProtect, nndPreferred);
+
+    if ( nndPreferred == NUMA_NO_PREFERRED_NODE || ( flAllocationType & MEM_RESERVE ) == 0 )
+    {
+        /* Pages committed in an existing region follow that region's node. */
+        pRetVal = VirtualAlloc( lpAddress, dwSize, flAllocationType, flProtect );
+        goto done;
+    }
+
+    pthrCurrent = InternalGetCurrentThread();
+
+    /* Reserve first so that the node is known before any page is committed. */
+    pRetVal = VirtualAlloc( lpAddress, dwSize, flAllocationType & ~MEM_COMMIT, flProtect );
+    if ( !pRetVal )
+    {
+        goto done;
+    }
+
+    InternalEnterCriticalSection(pthrCurrent, &virtual_critsec);
+    pInformation = VIRTUALFindRegionInformation( (UINT_PTR)pRetVal );
+    if ( pInformation )
+    {
+        pInformation->preferredNode = nndPreferred;
+    }
+    InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
+
+    if ( flAllocationType & MEM_COMMIT )
+    {
+        LPVOID pReserved = pRetVal;
+        pRetVal = VirtualAlloc( pReserved, dwSize, flAllocationType & ~MEM_RESERVE, flProtect );
+        if ( !pRetVal )
+        {
+            VirtualFree( pReserved, 0, MEM_RELEASE );
+        }
+    }
+
+done:
+    LOGEXIT("VirtualAllocExNuma returning %p\n ", pRetVal  );
+    return pRetVal;
+}
+
 /*++
 Function:
   VirtualAlloc
@@ -1630,6 +1830,10 @@ Note:
   MEM_TOP_DOWN, MEM_PHYSICAL, MEM_WRITE_WATCH are not supported.
   Unsupported flags are ignored.
 
+  MEM_LARGE_PAGES doesn't require the memory to be committed up front as it
+  does on Windows: the reservation is huge page aligned and committed pages
+  are advised to use transparent huge pages.
+
   Page size on i386 is set to 4k.
 
 See MSDN doc.
@@ -1658,10 +1862,10 @@ VirtualAlloc(
     }
 
     /* Test for un-supported flags. */
-    if ( ( flAllocationType & ~( MEM_COMMIT | MEM_RESERVE | MEM_TOP_DOWN | MEM_RESERVE_EXECUTABLE ) ) != 0 )
+    if ( ( flAllocationType & ~( MEM_COMMIT | MEM_RESERVE | MEM_TOP_DOWN | MEM_RESERVE_EXECUTABLE | MEM_LARGE_PAGES ) ) != 0 )
     {
         ASSERT( "flAllocationType can be one, or any combination of MEM_COMMIT, \
-               MEM_RESERVE, MEM_TOP_DOWN, or MEM_RESERVE_EXECUTABLE.\n" );
+               MEM_RESERVE, MEM_TOP_DOWN, MEM_RESERVE_EXECUTABLE, or MEM_LARGE_PAGES.\n" );
         pthrCurrent->SetLastError( ERROR_INVALID_PARAMETER );
         goto done;
     }
@@ -25,6 +25,7 @@ Revision History:
 
 #include <sched.h>
 #include <errno.h>
+#include <limits.h>
 #include <unistd.h>
 #include <sys/types.h>
 #if HAVE_SYSCTL
@@ -326,6 +327,159 @@ PAL_HasGetCurrentProcessorNumber()
     return HAVE_SCHED_GETCPU;
 }
 
+#ifdef __LINUX__
+// sysfs exposes each NUMA node as /sys/devices/system/node/node<N>, with a
+// cpu<M> entry for each of its processors. Node numbers may be sparse.
+static const ULONG MAX_NUMA_NODE_COUNT = 64;
+
+static BOOL NUMANodeExists(ULONG node)
+{
+    char path[64];
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%u", (unsigned) node);
+    return access(path, F_OK) == 0;
+}
+
+static BOOL NUMANodeHasProcessor(ULONG node, ULONG processor)
+{
+    char path[64];
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpu%u", (unsigned) node, (unsigned) processor);
+    return access(path, F_OK) == 0;
+}
+#endif // __LINUX__
+
+/*++
+Function:
+  GetNumaHighestNodeNumber
+
+Systems without NUMA information report a single node 0.
+
+See MSDN doc.
+--*/
+BOOL
+PALAPI
+GetNumaHighestNodeNumber(
+    OUT PULONG HighestNodeNumber)
+{
+    ULONG highestNode = 0;
+
+    ENTRY("GetNumaHighestNodeNumber(HighestNodeNumber=%p)\n", HighestNodeNumber);
+
+#ifdef __LINUX__
+    for (ULONG node = 1; node < MAX_NUMA_NODE_COUNT; node++)
+    {
+        if (NUMANodeExists(node))
+        {
+            highestNode = node;
+        }
+    }
+#endif // __LINUX__
+
+    *HighestNodeNumber = highestNode;
+
+    LOGEXIT("GetNumaHighestNodeNumber returns BOOL %d\n", TRUE);
+    return TRUE;
+}
+
+/*++
+Function:
+  GetNumaProcessorNode
+
+See MSDN doc.
+--*/
+BOOL
+PALAPI
+GetNumaProcessorNode(
+    IN UCHAR Processor,
+    OUT PUCHAR NodeNumber)
+{
+    BOOL fRetVal = FALSE;
+
+    ENTRY("GetNumaProcessorNode(Processor=%u, NodeNumber=%p)\n", Processor, NodeNumber);
+
+    *NodeNumber = 0xFF;
+    if (Processor >= PAL_GetLogicalCpuCountFromOS())
+    {
+        SetLastError(ERROR_INVALID_PARAMETER);
+        goto done;
+    }
+
+#ifdef __LINUX__
+    for (ULONG node = 0; node < MAX_NUMA_NODE_COUNT; node++)
+    {
+        if (NUMANodeHasProcessor(node, Processor))
+        {
+            *NodeNumber = (UCHAR) node;
+            fRetVal = TRUE;
+            goto done;
+        }
+    }
+#endif // __LINUX__
+
+    // No NUMA information, every processor is on node 0
+    *NodeNumber = 0;
+    fRetVal = TRUE;
+
+done:
+    LOGEXIT("GetNumaProcessorNode returns BOOL %d\n", fRetVal);
+    return fRetVal;
+}
+
+/*++
+Function:
+  GetNumaNodeProcessorMask
+
+Only the first 64 processors can be represented in the mask.
+
+See MSDN doc.
+--*/
+BOOL
+PALAPI
+GetNumaNodeProcessorMask(
+    IN UCHAR Node,
+    OUT PULONGLONG ProcessorMask)
+{
+    BOOL fRetVal = FALSE;
+    ULONG processorCount = PAL_GetLogicalCpuCountFromOS();
+    ULONGLONG mask = 0;
+
+    ENTRY("GetNumaNodeProcessorMask(Node=%u, ProcessorMask=%p)\n", Node, ProcessorMask);
+
+    processorCount = min(processorCount, (ULONG)(sizeof(mask) * CHAR_BIT));
+
+#ifdef __LINUX__
+    if (NUMANodeExists(Node))
+    {
+        for (ULONG processor = 0; processor < processorCount; processor++)
+        {
+            if (NUMANodeHasProcessor(Node, processor))
+            {
+                mask |= 1ull << processor;
+            }
+        }
+        fRetVal = TRUE;
+    }
+    else
+#endif // __LINUX__
+    if (Node == 0)
+    {
+        // No NUMA information, node 0 has every processor
+        for (ULONG processor = 0; processor < processorCount; processor++)
+        {
+            mask |= 1ull << processor;
+        }
+        fRetVal = TRUE;
+    }
+    else
+    {
+        SetLastError(ERROR_INVALID_PARAMETER);
+    }
+
+    *ProcessorMask = mask;
+
+    LOGEXIT("GetNumaNodeProcessorMask returns BOOL %d\n", fRetVal);
+    return fRetVal;
+}
+
 DWORD
 PALAPI
 PAL_GetLogicalCpuCountFromOS()
@@ -20,6 +20,7 @@
 
 #include <signal.h>
 #include <pthread.h>
+#include <sched.h>
 #if HAVE_PTHREAD_NP_H
 #include <pthread_np.h>
 #endif
@@ -1190,6 +1191,81 @@ SetThreadPriority(
     return NO_ERROR == palError;
 }
 
+/*++
+Function:
+  SetThreadAffinityMask
+
+Note:
+  Only the calling thread (GetCurrentThread()) can change its affinity, and
+  only the first 64 processors can be represented in the mask.
+
+See MSDN doc.
+--*/
+DWORD_PTR
+PALAPI
+SetThreadAffinityMask(
+          IN HANDLE hThread,
+          IN DWORD_PTR dwThreadAffinityMask)
+{
+    CPalThread *pThread;
+    DWORD_PTR previousMask = 0;
+
+    ENTRY("SetThreadAffinityMask(hThread=%p, dwThreadAffinityMask=%#lx)\n", hThread, dwThreadAffinityMask);
+
+    pThread = InternalGetCurrentThread();
+
+    if (hThread != hPseudoCurrentThread || dwThreadAffinityMask == 0)
+    {
+        pThread->SetLastError(ERROR_INVALID_PARAMETER);
+        goto done;
+    }
+
+#if HAVE_SCHED_SETAFFINITY
+    {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        if (sched_getaffinity(0, sizeof(cpuSet), &cpuSet) != 0)
+        {
+            pThread->SetLastError(ERROR_GEN_FAILURE);
+            goto done;
+        }
+
+        DWORD_PTR oldMask = 0;
+        for (size_t cpu = 0; cpu < sizeof(DWORD_PTR) * CHAR_BIT; cpu++)
+        {
+            if (CPU_ISSET(cpu, &cpuSet))
+            {
+                oldMask |= ((DWORD_PTR) 1) << cpu;
+            }
+        }
+
+        CPU_ZERO(&cpuSet);
+        for (size_t cpu = 0; cpu < sizeof(DWORD_PTR) * CHAR_BIT; cpu++)
+        {
+            if (dwThreadAffinityMask & (((DWORD_PTR) 1) << cpu))
+            {
+                CPU_SET(cpu, &cpuSet);
+            }
+        }
+
+        if (sched_setaffinity(0, sizeof(cpuSet), &cpuSet) != 0)
+        {
+            ERROR("sched_setaffinity() failed! Error(%d)=%s\n", errno, strerror(errno));
+            pThread->SetLastError(ERROR_INVALID_PARAMETER);
+            goto done;
+        }
+
+        previousMask = oldMask;
+    }
+#else // HAVE_SCHED_SETAFFINITY
+    pThread->SetLastError(ERROR_NOT_SUPPORTED);
+#endif // HAVE_SCHED_SETAFFINITY
+
+done:
+    LOGEXIT("SetThreadAffinityMask returns DWORD_PTR %#lx\n", previousMask);
+    return previousMask;
+}
+
 PAL_ERROR
 CorUnix::InternalSetThreadPriority(
     CPalThread *pThread,
@@ -0,0 +1,227 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Element-wise typed array loops (dst[i] = src[i] op k) are turned into Memcopy + Memadd/Memmul.
+// Compares the jitted results with a reference computed element by element.
+// need to run with -mic:1 -off:simplejit -off:jitloopbody -mmoc:0
+// Run locally with -trace:memop -trace:bailout to help find bugs
+
+const size = 100;
+let passed = true;
+
+function fill(TypedArray, n) {
+  let a = new TypedArray(n);
+  for(let i = 0; i < n; ++i) {
+    a[i] = (i & 1 ? -1 : 1) * i * 1.25 + (TypedArray === Int32Array ? 0x7ffffff0 : 0);
+  }
+  a[0] = TypedArray === Int32Array ? -0x80000000 : -0;
+  return a;
+}
+
+let testCases = [
+  {
+    name: "scaleFloat32",
+    type: Float32Array,
+    test: function(dst, src) {
+      for(let i = 0; i < size; i++) {
+        dst[i] = src[i] * 1.1;
+      }
+    },
+    ref: x => x * 1.1
+  },
+  {
+    name: "offsetFloat64",
+    type: Float64Array,
+    test: function(dst, src) {
+      for(let i = 0; i < size; i++) {
+        dst[i] = src[i] + 0.25;
+      }
+    },
+    ref: x => x + 0.25
+  },
+  {
+    name: "constantFirst",
+    type: Float64Array,
+    test: function(dst, src) {
+      for(let i = 0; i < size; i++) {
+        dst[i] = 3 * src[i];
+      }
+    },
+    ref: x => 3 * x
+  },
+  {
+    name: "invariantFactor",
+    type: Float32Array,
+    test: function(dst, src, k) {
+      for(let i = 0; i < size; i++) {
+        dst[i] = src[i] * k;
+      }
+    },
+    ref: x => x * 0.3
+  },
+  {
+    name: "subtractInPlace",
+    type: Float32Array,
+    inPlace: true,
+    test: function(dst) {
+      for(let i = 0; i < size; i++) {
+        dst[i] = dst[i] - 0;
+      }
+    },
+    ref: x => x - 0
+  },
+  {
+    name: "decrementingIndex",
+    type: Float64Array,
+    test: function(dst, src) {
+      for(let i = size - 1; i >= 0; i--) {
+        dst[i] = src[i] - 7.5;
+      }
+    },
+    ref: x => x - 7.5
+  },
+  {
+    name: "wrappingInt32",
+    type: Int32Array,
+    test: function(dst, src) {
+      for(let i = 0; i < size; i++) {
+        dst[i] = src[i] + 0x10;
+      }
+    },
+    ref: x => (x + 0x10) | 0
+  },
+  {
+    name: "subtractInt32",
+    type: Int32Array,
+    inPlace: true,
+    test: function(dst) {
+      for(let i = 0; i < size; i++) {
+        dst[i] = dst[i] - 0x20;
+      }
+    },
+    ref: x => (x - 0x20) | 0
+  },
+  {
+    name: "loadedValueUsedAgain",
+    type: Float64Array,
+    test: function(dst, src) {
+      // Not a valid pattern, the loaded value is still needed after the multiplication
+      let sum = 0;
+      for(let i = 0; i < size; i++) {
+        let m = src[i];
+        dst[i] = m * 2;
+        sum += m;
+      }
+      return sum;
+    },
+    ref: x => x * 2
+  },
+  {
+    name: "negativeStartIndex",
+    type: Float32Array,
+    start: -10,
+    test: function(dst, src) {
+      // The map must bail out on the negative index without touching the array
+      for(let i = -10; i < size; i++) {
+        dst[i] = src[i] * 2;
+      }
+    },
+    ref: x => x * 2
+  },
+  {
+    name: "inPlaceNegativeStartIndex",
+    type: Int32Array,
+    inPlace: true,
+    start: -10,
+    test: function(dst) {
+      // A partially applied in place map would be applied twice after the bailout
+      for(let i = -10; i < size; i++) {
+        dst[i] = dst[i] + 1;
+      }
+    },
+    ref: x => (x + 1) | 0
+  },
+  {
+    name: "overlappingViewsAhead",
+    type: Float64Array,
+    srcOffset: 0,
+    dstOffset: 4,
+    test: function(dst, src) {
+      // dst starts 4 elements after src in the same buffer, so the loop reads back what it wrote 4 iterations earlier
+      for(let i = 0; i < size; i++) {
+        dst[i] = src[i] + 1;
+      }
+    },
+    ref: x => x + 1
+  },
+  {
+    name: "overlappingViewsBehind",
+    type: Int32Array,
+    srcOffset: 4,
+    dstOffset: 0,
+    test: function(dst, src) {
+      for(let i = 0; i < size; i++) {
+        dst[i] = src[i] + 3;
+      }
+    },
+    ref: x => (x + 3) | 0
+  },
+  {
+    name: "identicalViews",
+    type: Float32Array,
+    srcOffset: 0,
+    dstOffset: 0,
+    test: function(dst, src) {
+      // Two typed arrays over the same elements behave like an in place map
+      for(let i = 0; i < size; i++) {
+        dst[i] = src[i] * 2;
+      }
+    },
+    ref: x => x * 2
+  }
+];
+
+function makeArrays(testCase) {
+  if(testCase.dstOffset === undefined) {
+    let src = fill(testCase.type, size);
+    return { src: src, dst: testCase.inPlace ? src : new testCase.type(size) };
+  }
+  // Views of one buffer, starting srcOffset and dstOffset elements in
+  let buffer = fill(testCase.type, size + Math.max(testCase.srcOffset, testCase.dstOffset)).buffer;
+  let bytes = testCase.type.BYTES_PER_ELEMENT;
+  return {
+    src: new testCase.type(buffer, testCase.srcOffset * bytes, size),
+    dst: new testCase.type(buffer, testCase.dstOffset * bytes, size)
+  };
+}
+
+for(let testCase of testCases) {
+  // Run a few times so that the function is jitted and rejitted after a memop bailout
+  for(let run = 0; run < 4; ++run) {
+    let arrays = makeArrays(testCase);
+    let dst = arrays.dst;
+    testCase.test(dst, arrays.src, 0.3);
+
+    // The reference runs the same loop element by element on arrays laid out the same way
+    let expected = makeArrays(testCase);
+    let reference = expected.dst;
+    for(let i = 0; i < size; ++i) {
+      reference[i] = testCase.ref(expected.src[i]);
+    }
+    for(let i = 0; i < size; ++i) {
+      if(!Object.is(dst[i], reference[i])) {
+        print(`Error ${testCase.name} (run ${run}): dst[${i}](${dst[i]}) !== ${reference[i]}`);
+        passed = false;
+        break;
+      }
+    }
+  }
+}
+
+if(passed) {
+  print("PASSED");
+} else {
+  print("FAILED");
+}
@@ -0,0 +1,69 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Arithmetic and bitwise operators on two number literals are folded by the parser. Compare each folded
+// expression with the same operator applied at run time.
+
+var failed = 0;
+
+function check(description, folded, left, right, op) {
+    var expected = op(left, right);
+    if (!Object.is(folded, expected)) {
+        WScript.Echo("FAILED: " + description + " folded to " + folded + ", expected " + expected);
+        failed++;
+    }
+}
+
+function add(a, b) { return a + b; }
+function sub(a, b) { return a - b; }
+function mul(a, b) { return a * b; }
+function div(a, b) { return a / b; }
+function or(a, b) { return a | b; }
+function xor(a, b) { return a ^ b; }
+function and(a, b) { return a & b; }
+function lsh(a, b) { return a << b; }
+function rsh(a, b) { return a >> b; }
+function rs2(a, b) { return a >>> b; }
+
+check("1 + 2", 1 + 2, 1, 2, add);
+check("0x7fffffff + 1", 0x7fffffff + 1, 0x7fffffff, 1, add);
+check("0.1 + 0.2", 0.1 + 0.2, 0.1, 0.2, add);
+check("1 + 2 + 3", 1 + 2 + 3, 3, 3, add);
+check("-2147483648 - 1", -2147483648 - 1, -2147483648, 1, sub);
+check("1.5 - 0.5", 1.5 - 0.5, 1.5, 0.5, sub);
+check("65536 * 65536", 65536 * 65536, 65536, 65536, mul);
+check("0 * -1", 0 * -1, 0, -1, mul);
+check("-0 * 1", -0 * 1, -0, 1, mul);
+check("6 / 3", 6 / 3, 6, 3, div);
+check("1 / 3", 1 / 3, 1, 3, div);
+check("1 / 0", 1 / 0, 1, 0, div);
+check("-1 / 0", -1 / 0, -1, 0, div);
+check("0 / 0", 0 / 0, 0, 0, div);
+check("1 / -Infinity", 1 / -1e400, 1, -Infinity, div);
+check("0xf0 | 0x0f", 0xf0 | 0x0f, 0xf0, 0x0f, or);
+check("1.5 | 0", 1.5 | 0, 1.5, 0, or);
+check("0xff ^ 0x0f", 0xff ^ 0x0f, 0xff, 0x0f, xor);
+check("-1 & 0xff", -1 & 0xff, -1, 0xff, and);
+check("1 << 31", 1 << 31, 1, 31, lsh);
+check("1 << 32", 1 << 32, 1, 32, lsh);
+check("3 << -1", 3 << -1, 3, -1, lsh);
+check("-16 >> 2", -16 >> 2, -16, 2, rsh);
+check("-16 >> 33", -16 >> 33, -16, 33, rsh);
+check("-1 >>> 0", -1 >>> 0, -1, 0, rs2);
+check("-16 >>> 28", -16 >>> 28, -16, 28, rs2);
+
+// Folding must not change evaluation order or skip conversions of operands that are not literals
+var log = "";
+var o = { valueOf: function () { log += "o"; return 2; } };
+check("o * 3 * 4", o * 3 * 4, 6, 4, mul);
+check("\"1\" + 2 + 3", "1" + 2 + 3, "12", 3, add);
+if (log !== "o") {
+    WScript.Echo("FAILED: valueOf called " + log.length + " times");
+    failed++;
+}
+
+if (failed === 0) {
+    WScript.Echo("pass");
+}
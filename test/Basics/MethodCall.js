@@ -0,0 +1,71 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Method calls without arguments, o.f(), load the method with LdMethodFldCallI and run the call from the same
+// interpreter handler. Check the 'this' value, the result, and the errors thrown by the load and by the call.
+
+function Counter() { this.count = 0; }
+Counter.prototype.next = function () { return ++this.count; };
+
+var counter = new Counter();
+var own = { value: 1, get: function () { return this.value; } };
+var nested = { inner: { name: "inner", who: function () { return this.name; } } };
+var accessor = { get method() { WScript.Echo("getter called"); return function () { return "from getter"; }; } };
+
+function test(o) {
+    return o.get();
+}
+
+function callAll() {
+    var total = 0;
+    for (var i = 0; i < 100; i++) {
+        total += counter.next();
+    }
+    return total;
+}
+
+WScript.Echo(counter.next());
+WScript.Echo(callAll());
+WScript.Echo(own.get());
+WScript.Echo(test({ value: 2, get: own.get }));
+WScript.Echo(test({ get: function () { return typeof this; } }));
+WScript.Echo(nested.inner.who());
+WScript.Echo(accessor.method());
+WScript.Echo((12.5).toString());
+WScript.Echo("abc".toUpperCase());
+WScript.Echo([3, 1, 2].sort().join());
+
+// The call uses the value of the method loaded before it, even if calling it changes the property
+var replaced = {
+    f: function () { replaced.f = function () { return "second"; }; return "first"; }
+};
+WScript.Echo(replaced.f());
+WScript.Echo(replaced.f());
+
+// Unused results and calls as statements
+var log = [];
+var logger = { add: function () { log.push(this === logger); } };
+logger.add();
+logger.add();
+WScript.Echo(log.join());
+
+function tryCall(description, fn) {
+    try {
+        fn();
+        WScript.Echo(description + ": no exception");
+    } catch (e) {
+        WScript.Echo(description + ": " + e.name);
+    }
+}
+
+tryCall("missing method", function () { return own.missing(); });
+tryCall("not a function", function () { return own.value(); });
+tryCall("undefined object", function () { var u; return u.f(); });
+tryCall("null object", function () { var n = null; return n.f(); });
+tryCall("throwing method", function () { return { f: function () { throw new RangeError(); } }.f(); });
+
+for (var i = 0; i < 3; i++) {
+    WScript.Echo(test(i === 2 ? { get: function () { return "changed"; } } : own));
+}
@@ -0,0 +1,78 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Temp object literals whose fields are only read back in the same function are removed by the dead store pass.
+// Object literals that escape or that a bailout needs to restore must be kept. Array literals and constructed
+// objects are not candidates.
+
+function Point(x, y) {
+    this.x = x;
+    this.y = y;
+}
+
+// Dead object literal. Both fields are read before the arithmetic, so no bailout of the arithmetic needs the object.
+function deadLiteral(x, y) {
+    var o = { a: x, b: y };
+    var a = o.a;
+    var b = o.b;
+    return a * 2 + b;
+}
+
+// Array literals are not removed
+function deadArray(x) {
+    var a = [x, x + 1];
+    return a[0] + a[1];
+}
+
+// Constructed objects are not removed
+function deadNew(x, y) {
+    var p = new Point(x, y);
+    return p.x - p.y;
+}
+
+// Escaping temps must survive
+var kept = [];
+function escapeToArray(x) {
+    var o = { a: x };
+    kept[x & 3] = o;
+    return o.a;
+}
+
+function escapeToClosure(x) {
+    var o = { a: x };
+    return function () { return o.a; };
+}
+
+function escapeByReturn(x) {
+    var o = { a: x, b: x + 1 };
+    return o;
+}
+
+// The int specialized add bails out when x is a string, the interpreter then reads the object again
+function observedByBailout(x, y) {
+    var o = { a: x, b: y };
+    var s = o.a + o.b;
+    return s + "/" + o.a + "/" + o.b;
+}
+
+var sum = 0;
+var closureSum = 0;
+var returnSum = 0;
+var observed = "";
+for (var i = 0; i < 200; i++) {
+    sum += deadLiteral(i, 1) + deadArray(i) + deadNew(i, 2) + escapeToArray(i);
+    closureSum += escapeToClosure(i)();
+    var r = escapeByReturn(i);
+    returnSum += r.a + r.b;
+    observed = observedByBailout(i, 3);
+}
+
+WScript.Echo("dead: " + sum);
+WScript.Echo("closure: " + closureSum);
+WScript.Echo("return: " + returnSum);
+WScript.Echo("kept: " + kept.map(function (o) { return o.a; }).join(","));
+WScript.Echo("observed: " + observed);
+WScript.Echo("bailout: " + observedByBailout("x", 3));
+WScript.Echo("after bailout: " + observedByBailout(4, 3));
@@ -0,0 +1,23 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// A few long iterations of an outer loop around a hot inner loop. Once the jitted inner loop body exits, the outer loop
+// is profiled right away and jitted as one loop body covering the whole nest.
+
+function run(rows, columns) {
+    var sum = 0;
+    var checksum = 0;
+    for (var i = 0; i < rows; i++) {
+        var row = 0;
+        for (var j = 0; j < columns; j++) {
+            row += (i * columns + j) % 7;
+        }
+        sum += row;
+        checksum = (checksum * 31 + row) | 0;
+    }
+    return sum + "," + checksum;
+}
+
+WScript.Echo("run: " + run(10, 1000));
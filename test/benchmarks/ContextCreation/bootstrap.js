@@ -0,0 +1,51 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Cost of a new context that runs an embedder style bootstrap bundle before it is handed out: a module registry,
+// a few classes, frozen configuration and patched prototypes.
+
+var contexts = 200;
+
+var bootstrap = (function ()
+{
+    var source = [];
+    source.push("var registry = Object.create(null);");
+    source.push("function define(name, factory) { registry[name] = { factory: factory, exports: undefined }; }");
+    source.push("function require(name) { var m = registry[name]; if (m.exports === undefined) { m.exports = {}; m.factory(m.exports, require); } return m.exports; }");
+    for (var i = 0; i < 40; i++)
+    {
+        source.push(
+            "define('module" + i + "', function (exports, require) {" +
+            "  class Service" + i + " {" +
+            "    constructor(options) { this.options = Object.assign({ id: " + i + " }, options); this.cache = new Map(); }" +
+            "    get id() { return this.options.id; }" +
+            "    lookup(key) { if (!this.cache.has(key)) { this.cache.set(key, key + this.id); } return this.cache.get(key); }" +
+            "  }" +
+            "  exports.Service = Service" + i + ";" +
+            "  exports.config = Object.freeze({ name: 'module" + i + "', retries: " + (i % 5) + ", tags: ['a', 'b', 'c'] });" +
+            "});");
+    }
+    source.push("Object.defineProperty(Array.prototype, 'last', { get: function () { return this[this.length - 1]; }, configurable: true });");
+    source.push("String.prototype.padStartCompat = function (n, c) { var s = String(this); while (s.length < n) { s = c + s; } return s; };");
+    source.push("var services = [];");
+    source.push("for (var i = 0; i < 40; i++) { var m = require('module' + i); services.push(new m.Service({ enabled: true })); }");
+    source.push("var ready = services.last.lookup(1) + services.length;");
+    return source.join("\n");
+})();
+
+var start = new Date();
+var checksum = 0;
+for (var n = 0; n < contexts; n++)
+{
+    var global = WScript.LoadScript(bootstrap, "samethread");
+    checksum += global.ready;
+}
+var interval = new Date() - start;
+
+if (checksum !== contexts * (1 + 39 + 40))
+{
+    WScript.Echo("FAILED: checksum " + checksum);
+}
+WScript.Echo("### TIME:", interval, "ms");
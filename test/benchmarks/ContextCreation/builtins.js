@@ -0,0 +1,34 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Cost of a new context plus the first use of the built-ins whose initialization the library defers.
+
+var contexts = 300;
+
+var firstUse =
+    "var m = new Map(); m.set('a', 1);" +
+    "var s = new Set([1, 2, 3]);" +
+    "var t = new Float64Array(4); t.fill(1.5);" +
+    "var p = Promise.resolve(1);" +
+    "var r = /a(b+)c/g.exec('xabbbc');" +
+    "var j = JSON.parse(JSON.stringify({ a: [1, 2, 3], b: 'x' }));" +
+    "var y = Symbol('y');" +
+    "var d = new Date(0).toISOString();" +
+    "var sum = [1, 2, 3].map(function (x) { return x * 2; }).reduce(function (a, b) { return a + b; }, 0);";
+
+var start = new Date();
+var checksum = 0;
+for (var n = 0; n < contexts; n++)
+{
+    var global = WScript.LoadScript(firstUse, "samethread");
+    checksum += global.sum + global.t[3] + global.s.size;
+}
+var interval = new Date() - start;
+
+if (checksum !== contexts * (12 + 1.5 + 3))
+{
+    WScript.Echo("FAILED: checksum " + checksum);
+}
+WScript.Echo("### TIME:", interval, "ms");
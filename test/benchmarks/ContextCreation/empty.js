@@ -0,0 +1,26 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Cost of JsCreateContext plus host object setup, with nothing run in the new context.
+
+var contexts = 500;
+
+var start = new Date();
+var created = 0;
+for (var n = 0; n < contexts; n++)
+{
+    var global = WScript.LoadScript("", "samethread");
+    if (typeof global.Object === "function")
+    {
+        created++;
+    }
+}
+var interval = new Date() - start;
+
+if (created !== contexts)
+{
+    WScript.Echo("FAILED: created " + created + " contexts");
+}
+WScript.Echo("### TIME:", interval, "ms");
@@ -0,0 +1,51 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Copy idiom over typed arrays: dst[i] = src[i]. Collapsed into a single call by MemCopy.
+
+var length = 1 << 16;
+var iterations = 4000;
+
+var srcF32 = new Float32Array(length);
+var dstF32 = new Float32Array(length);
+var srcI32 = new Int32Array(length);
+var dstI32 = new Int32Array(length);
+for (var i = 0; i < length; i++)
+{
+    srcF32[i] = i * 0.25;
+    srcI32[i] = i;
+}
+
+function copyFloat32(dst, src)
+{
+    for (var i = 0; i < src.length; i++)
+    {
+        dst[i] = src[i];
+    }
+}
+
+function copyInt32(dst, src)
+{
+    for (var i = 0; i < src.length; i++)
+    {
+        dst[i] = src[i];
+    }
+}
+
+var start = new Date();
+var checksum = 0;
+for (var n = 0; n < iterations; n++)
+{
+    copyFloat32(dstF32, srcF32);
+    copyInt32(dstI32, srcI32);
+    checksum += dstF32[n & (length - 1)] + dstI32[n & (length - 1)];
+}
+var interval = new Date() - start;
+
+if (checksum !== 1.25 * (iterations - 1) * iterations / 2)
+{
+    WScript.Echo("FAILED: checksum " + checksum);
+}
+WScript.Echo("### TIME:", interval, "ms");
@@ -0,0 +1,44 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Fill idiom over typed arrays: a[i] = c. Collapsed into a single call by MemSet.
+
+var length = 1 << 16;
+var iterations = 4000;
+
+var f32 = new Float32Array(length);
+var i32 = new Int32Array(length);
+
+function fillFloat32(a, value)
+{
+    for (var i = 0; i < a.length; i++)
+    {
+        a[i] = value;
+    }
+}
+
+function fillInt32(a, value)
+{
+    for (var i = 0; i < a.length; i++)
+    {
+        a[i] = value;
+    }
+}
+
+var start = new Date();
+var checksum = 0;
+for (var n = 0; n < iterations; n++)
+{
+    fillFloat32(f32, n + 0.5);
+    fillInt32(i32, n);
+    checksum += f32[n & (length - 1)] + i32[(n * 7) & (length - 1)];
+}
+var interval = new Date() - start;
+
+if (checksum !== (iterations - 1) * iterations + iterations / 2)
+{
+    WScript.Echo("FAILED: checksum " + checksum);
+}
+WScript.Echo("### TIME:", interval, "ms");
@@ -0,0 +1,51 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Element-wise map idiom over typed arrays: dst[i] = src[i] op c.
+
+var length = 1 << 16;
+var iterations = 2000;
+
+var srcF32 = new Float32Array(length);
+var dstF32 = new Float32Array(length);
+var srcI32 = new Int32Array(length);
+var dstI32 = new Int32Array(length);
+for (var i = 0; i < length; i++)
+{
+    srcF32[i] = i & 0xff;
+    srcI32[i] = i;
+}
+
+function scaleFloat32(dst, src, scale)
+{
+    for (var i = 0; i < src.length; i++)
+    {
+        dst[i] = src[i] * scale;
+    }
+}
+
+function offsetInt32(dst, src, offset)
+{
+    for (var i = 0; i < src.length; i++)
+    {
+        dst[i] = (src[i] + offset) | 0;
+    }
+}
+
+var start = new Date();
+var checksum = 0;
+for (var n = 0; n < iterations; n++)
+{
+    scaleFloat32(dstF32, srcF32, 0.5);
+    offsetInt32(dstI32, srcI32, n);
+    checksum += dstF32[length - 1] + dstI32[0];
+}
+var interval = new Date() - start;
+
+if (checksum !== iterations * 127.5 + (iterations - 1) * iterations / 2)
+{
+    WScript.Echo("FAILED: checksum " + checksum);
+}
+WScript.Echo("### TIME:", interval, "ms");
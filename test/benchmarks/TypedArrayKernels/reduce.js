@@ -0,0 +1,51 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Reduction idiom over typed arrays: sum += a[i].
+
+var length = 1 << 16;
+var iterations = 2000;
+
+var f64 = new Float64Array(length);
+var i32 = new Int32Array(length);
+for (var i = 0; i < length; i++)
+{
+    f64[i] = 0.5;
+    i32[i] = i & 0xf;
+}
+
+function sumFloat64(a)
+{
+    var sum = 0;
+    for (var i = 0; i < a.length; i++)
+    {
+        sum += a[i];
+    }
+    return sum;
+}
+
+function sumInt32(a)
+{
+    var sum = 0;
+    for (var i = 0; i < a.length; i++)
+    {
+        sum = (sum + a[i]) | 0;
+    }
+    return sum;
+}
+
+var start = new Date();
+var checksum = 0;
+for (var n = 0; n < iterations; n++)
+{
+    checksum += sumFloat64(f64) + sumInt32(i32);
+}
+var interval = new Date() - start;
+
+if (checksum !== iterations * (length / 2 + (length / 16) * 120))
+{
+    WScript.Echo("FAILED: checksum " + checksum);
+}
+WScript.Echo("### TIME:", interval, "ms");
@@ -0,0 +1,37 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Single precision a * x + y over typed arrays: y[i] = a * x[i] + y[i].
+
+var length = 1 << 16;
+var iterations = 2000;
+
+var x = new Float32Array(length);
+var y = new Float32Array(length);
+for (var i = 0; i < length; i++)
+{
+    x[i] = 1;
+}
+
+function saxpy(a, x, y)
+{
+    for (var i = 0; i < x.length; i++)
+    {
+        y[i] = a * x[i] + y[i];
+    }
+}
+
+var start = new Date();
+for (var n = 0; n < iterations; n++)
+{
+    saxpy(2, x, y);
+}
+var interval = new Date() - start;
+
+if (y[0] !== 2 * iterations || y[length - 1] !== 2 * iterations)
+{
+    WScript.Echo("FAILED: y[0] " + y[0]);
+}
+WScript.Echo("### TIME:", interval, "ms");
@@ -0,0 +1,83 @@
+# -------------------------------------------------------------------------------------------------------
+# Copyright (C) Microsoft. All rights reserved.
+# Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+# -------------------------------------------------------------------------------------------------------
+#
+# Runs the octane and kraken benchmarks with -DumpAllocHistogram and reports how many bytes each
+# benchmark loses to small/medium size class rounding. Requires a build with RECYCLER_STATS.
+#
+# To compare size class tables, run this script against a default build and against a build with
+# RECYCLER_GEOMETRIC_SIZE_CLASSES defined, then use perf.pl -baseline / perf.pl on the same two
+# binaries to compare allocation throughput.
+
+use strict;
+
+my $binary = "";
+my @switches = ();
+
+foreach my $arg (@ARGV)
+{
+    if($arg =~ /[-\/]binary:(.*)$/)
+    {
+        $binary = $1;
+    }
+    elsif($arg =~ /[-\/]\?/)
+    {
+        $binary = "";
+        last;
+    }
+    else
+    {
+        push(@switches, $arg);
+    }
+}
+
+if($binary eq "")
+{
+    print "Usage: perl allochistogram.pl -binary:<path>\\ch.exe [additional ch switches]\n\n";
+    print "Prints the per benchmark size class waste reported by -DumpAllocHistogram\n";
+    print "for the octane and kraken suites.\n";
+    exit(1);
+}
+
+my %suites = (
+    "Octane" => ["box2d", "code-load", "crypto", "deltablue", "earley-boyer", "gbemu", "navier-stokes",
+                 "pdfjs", "raytrace", "regexp", "richards", "splay", "typescript", "zlib"],
+    "Kraken" => ["ai-astar", "audio-beat-detection", "audio-dft", "audio-fft", "audio-oscillator", "imaging-darkroom",
+                 "imaging-desaturate", "imaging-gaussian-blur", "json-parse-financial", "json-stringify-tinderbox",
+                 "stanford-crypto-aes", "stanford-crypto-ccm", "stanford-crypto-pbkdf2", "stanford-crypto-sha256-iterative"]
+);
+
+my $sizeClasses = "unknown";
+my ($sumRequest, $sumAlloc, $sumWasted) = (0, 0, 0);
+
+printf("%-40s %12s %15s %15s %15s %7s\n", "Test", "AllocCount", "RequestBytes", "AllocBytes", "WastedBytes", "Waste%");
+
+foreach my $suite (sort keys %suites)
+{
+    foreach my $test (@{$suites{$suite}})
+    {
+        my $testpath = "$suite/$test.js";
+        my $output = `$binary -DumpAllocHistogram @switches $testpath 2>&1`;
+
+        if($output =~ /Size classes: (.*)$/m)
+        {
+            $sizeClasses = $1;
+        }
+
+        if($output !~ /^Total\s+(\d+)\s+(\d+)\s+(\d+)\s+(\d+)\s+([\d\.]+)/m)
+        {
+            print "$testpath: no allocation histogram in output (is the binary built with RECYCLER_STATS?)\n";
+            exit(1);
+        }
+
+        printf("%-40s %12s %15s %15s %15s %7s\n", "$suite/$test", $1, $2, $3, $4, $5);
+        $sumRequest += $2;
+        $sumAlloc += $3;
+        $sumWasted += $4;
+    }
+}
+
+printf("%-40s %12s %15s %15s %15s %7.1f\n", "Total", "", $sumRequest, $sumAlloc, $sumWasted,
+    $sumAlloc ? ($sumWasted * 100.0 / $sumAlloc) : 0);
+print "Size classes: $sizeClasses\n";
@@ -577,6 +577,8 @@ sub usage
     print "  -kraken                Run the kraken benchmark\n";
     print "  -octane                Run the Octane 2.0 benchmark\n";
     print "  -jetstream             Run the JetStream benchmark (only non octane and sunspider tests)\n";
+    print "  -typedarraykernels     Run the typed array loop kernel microbenchmarks\n";
+    print "  -contextcreation       Run the script context creation microbenchmarks\n";
     print "  -file:<file>           Run the specified js file\n";
     print "  -args:<other args>     Other arguments to ch.exe\n";
     print "  -score                 Test output scores\n";
@@ -686,6 +688,20 @@ sub parse_args
             $basefile = "perfbase$dir.txt";
             $is_dynamicProfileRun = 0; # Currently  dyna-pogo info is not avialable in the browser - remove this when it is.
         }
+        elsif($ARGV[$i] =~ /[-\/]typedarraykernels/i)
+        {
+            @testlist = ("fill", "copy", "map", "saxpy", "reduce");
+            $testDescription = "typed array kernels";
+            $dir = "TypedArrayKernels";
+            $basefile = "perfbase$dir.txt";
+        }
+        elsif($ARGV[$i] =~ /[-\/]contextcreation/i)
+        {
+            @testlist = ("empty", "builtins", "bootstrap", "bootstrap_snapshot");
+            $testDescription = "context creation";
+            $dir = "ContextCreation";
+            $basefile = "perfbase$dir.txt";
+        }
         elsif($ARGV[$i] =~ /[-\/]kraken/i)
         {
             if($iter == $defaultIter)
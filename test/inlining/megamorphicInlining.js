@@ -0,0 +1,45 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// A call site with more than four targets. Under -MegamorphicInline the most called targets are inlined and
+// the others are called out of line instead of bailing out.
+
+function T0() { } T0.prototype.get = function (x) { return x + 0; };
+function T1() { } T1.prototype.get = function (x) { return x + 1; };
+function T2() { } T2.prototype.get = function (x) { return x + 2; };
+function T3() { } T3.prototype.get = function (x) { return x + 3; };
+function T4() { } T4.prototype.get = function (x) { return x + 4; };
+function T5() { } T5.prototype.get = function (x) { return x + 5; };
+function T6() { } T6.prototype.get = function (x) { return x + 6; };
+
+var objs = [new T0(), new T1(), new T2(), new T3(), new T4(), new T5()];
+
+// T0 is called most, then T1. T2 to T5 are the cold targets: they take turns in the last two profile slots,
+// which end up holding T4 and T5.
+function pick(i) {
+    var r = i % 10;
+    return r < 8 ? (r < 5 ? 0 : 1) : 2 + (i % 4);
+}
+
+function run(n, x) {
+    var sum = 0;
+    for (var i = 0; i < n; i++) {
+        sum += objs[pick(i)].get(x);
+    }
+    return sum;
+}
+
+// Megamorphic site, hot and cold targets. With the test flags run is full JITed on its third call.
+for (var k = 0; k < 5; k++) {
+    WScript.Echo("run " + k + ": " + run(100, k));
+}
+
+// A target the profile never saw goes through the out of line call
+objs[5] = new T6();
+WScript.Echo("with unseen target: " + run(100, 1));
+
+// A string argument bails out of the int specialized add in the inlined targets
+WScript.Echo("bailout: " + run(10, "x"));
+WScript.Echo("after bailout: " + run(100, 2));
@@ -0,0 +1,19 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Run once per process by test_native.sh, against the same -JitWarmupCacheDir each time
+
+function hot(a, i) {
+    return a[i & 7] * 3 + i;
+}
+
+var a = [1, 2, 3, 4, 5, 6, 7, 8];
+var sum = 0;
+for (var j = 0; j < 10; j++) {
+    for (var i = 0; i < 1000; i++) {
+        sum += hot(a, i);
+    }
+}
+print(sum);
@@ -0,0 +1,145 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#include "ChakraCore.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string>
+#include <cstring>
+#include <unistd.h>
+
+#define FAIL_CHECK(cmd)                     \
+    do                                      \
+    {                                       \
+        JsErrorCode errCode = cmd;          \
+        if (errCode != JsNoError)           \
+        {                                   \
+            printf("Error %d at '%s'\n",    \
+                errCode, #cmd);             \
+            return 1;                       \
+        }                                   \
+    } while(0)
+
+#define EXPECT(cond)                        \
+    do                                      \
+    {                                       \
+        if (!(cond))                        \
+        {                                   \
+            printf("Failed '%s'\n", #cond); \
+            return 1;                       \
+        }                                   \
+    } while(0)
+
+using namespace std;
+
+static bool CHAKRA_CALLBACK LoadSource(JsSourceContext sourceContext, JsValueRef *value, JsParseScriptAttributes *parseAttributes)
+{
+    // sourceContext is the script the file was serialized from
+    const char* script = reinterpret_cast<const char*>(sourceContext);
+    *parseAttributes = JsParseScriptAttributeNone;
+    return JsCreateExternalArrayBuffer((void*)script, (unsigned int)strlen(script), nullptr, nullptr, value) == JsNoError;
+}
+
+// Serializes script and writes the first length bytes of the buffer, or all of it if length is 0, to path
+static int WriteSerializedFile(const char* script, const char* path, unsigned int length)
+{
+    JsValueRef scriptSource;
+    FAIL_CHECK(JsCreateExternalArrayBuffer((void*)script, (unsigned int)strlen(script), nullptr, nullptr, &scriptSource));
+
+    unsigned int bufferSize = 0;
+    FAIL_CHECK(JsSerialize(scriptSource, nullptr, &bufferSize, JsParseScriptAttributeNone));
+    BYTE* buffer = new BYTE[bufferSize];
+    FAIL_CHECK(JsSerialize(scriptSource, buffer, &bufferSize, JsParseScriptAttributeNone));
+
+    if (length == 0 || length > bufferSize)
+    {
+        length = bufferSize;
+    }
+
+    FILE* file = fopen(path, "wb");
+    EXPECT(file != nullptr);
+    EXPECT(fwrite(buffer, 1, length, file) == length);
+    fclose(file);
+    delete[] buffer;
+    return 0;
+}
+
+static int RunFile(const char* path, const char* script, JsValueRef* result)
+{
+    JsValueRef pathString, sourceUrl;
+    FAIL_CHECK(JsCreateStringUtf8((const uint8_t*)path, strlen(path), &pathString));
+    FAIL_CHECK(JsCreateStringUtf8((const uint8_t*)"sample", strlen("sample"), &sourceUrl));
+    return (int)JsRunSerializedFile(pathString, LoadSource, (JsSourceContext)script, sourceUrl, result);
+}
+
+static int CheckResult(JsValueRef result, const char* expected)
+{
+    char resultSTR[64];
+    size_t written = 0;
+    FAIL_CHECK(JsCopyStringUtf8(result, (uint8_t*)resultSTR, sizeof(resultSTR) - 1, &written));
+    resultSTR[written] = 0;
+    EXPECT(strcmp(resultSTR, expected) == 0);
+    return 0;
+}
+
+int main()
+{
+    JsRuntimeHandle runtime;
+    JsContextRef context;
+    JsValueRef result;
+
+    const char* script = "(()=>{return \'mapped\';})()";
+    const char* replacement = "(()=>{return \'replaced\';})()";
+
+    char path[] = "/tmp/chakra-serialized-XXXXXX";
+    char shortPath[] = "/tmp/chakra-serialized-short-XXXXXX";
+    char newPath[] = "/tmp/chakra-serialized-new-XXXXXX";
+    int fd;
+    EXPECT((fd = mkstemp(path)) != -1);
+    close(fd);
+    EXPECT((fd = mkstemp(shortPath)) != -1);
+    close(fd);
+    EXPECT((fd = mkstemp(newPath)) != -1);
+    close(fd);
+
+    // Create a runtime.
+    JsCreateRuntime(JsRuntimeAttributeNone, nullptr, &runtime);
+
+    // Create an execution context.
+    JsCreateContext(runtime, &context);
+
+    // Now set the current execution context.
+    JsSetCurrentContext(context);
+
+    EXPECT(WriteSerializedFile(script, path, 0) == 0);
+    EXPECT(WriteSerializedFile(script, shortPath, 64) == 0);
+
+    // The second run uses the view already mapped for the file
+    for (int i = 0; i < 2; i++)
+    {
+        EXPECT(RunFile(path, script, &result) == JsNoError);
+        EXPECT(CheckResult(result, "mapped") == 0);
+    }
+
+    // A truncated file is rejected
+    EXPECT(RunFile(shortPath, script, &result) == JsErrorInvalidArgument);
+    EXPECT(RunFile("/tmp/chakra-serialized-does-not-exist", script, &result) == JsErrorInvalidArgument);
+
+    // A file replaced at the same path is mapped again
+    EXPECT(WriteSerializedFile(replacement, newPath, 0) == 0);
+    EXPECT(rename(newPath, path) == 0);
+    EXPECT(RunFile(path, replacement, &result) == JsNoError);
+    EXPECT(CheckResult(result, "replaced") == 0);
+
+    // Dispose runtime
+    JsSetCurrentContext(JS_INVALID_REFERENCE);
+    JsDisposeRuntime(runtime);
+
+    unlink(path);
+    unlink(shortPath);
+
+    printf("Result -> SUCCESS \n");
+    return 0;
+}
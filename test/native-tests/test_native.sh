@@ -65,10 +65,47 @@ RUN () {
     fi
 }
 
+# Runs test.js in a fresh ch process per iteration against the same cache directory
+RUN_RESTARTS () {
+    TEST_PATH=$1
+    echo "Testing $TEST_PATH"
+
+    if [[ $CH_DIR =~ "/Release/" ]]; then
+        # -trace is not available in release builds
+        echo "Ignoring $TEST_PATH"
+        return
+    fi
+
+    local CACHE_DIR=$(mktemp -d)
+    RES=
+    for i in 1 2 3 4
+    do
+        RES+="run ${i}"$'\n'
+        RES+=$(cd $TEST_PATH; ${CH_DIR} $2 -JitWarmupCacheDir:${CACHE_DIR} test.js 2>&1)$'\n'
+    done
+    rm -rf ${CACHE_DIR}
+
+    # The fingerprint depends on the script hash, only its stability across runs matters
+    RES=$(echo -n "$RES" | sed 's/0x[0-9a-f]\{8\}/0x????????/')
+    if [[ "$RES" == "$(cat $TEST_PATH/test.baseline)" ]]; then
+        echo "${TEST_PATH} : PASS"
+    else
+        echo "${TEST_PATH} FAILED"
+        echo -e "$RES"
+        exit 1
+    fi
+}
+
 # test-char16
 RUN "test-char16"
 
 # test-static-native
 RUN "test-static-native"
 
+# test-serialized-file
+RUN "test-serialized-file"
+
+# test-jit-warmup-cache: record, confirm, then fast track on two more restarts
+RUN_RESTARTS "test-jit-warmup-cache" "-trace:JitWarmupCache -bgjit- -off:jitloopbody"
+
 SAFE_RUN `rm -rf Makefile`